@@ -39,6 +39,7 @@
 #include <LORE/Resource/Sprite.h>
 #include <LORE/Resource/Textbox.h>
 #include <LORE/Scene/SpriteController.h>
+#include <LORE/Serializer/Serializer.h>
 
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
 
@@ -70,6 +71,9 @@ Context::~Context()
 
   destroyAllCameras();
 
+  // Dump pool usage while every pool is still registered, for tuning pool sizes.
+  _poolCluster.logPoolStats();
+
   // Explicitly destroy Prefab/Model/Scene objects before resources, otherwise the order of destruction
   // in the pool cluster can lead to crashes, since resources (such as Box or Light) can be destroyed
   // before the owning object tries to delete them (AABBs for Boxes).
@@ -86,23 +90,27 @@ Context::~Context()
 void Context::initConfiguration()
 {
   // Setup default memory pool settings. (TODO: Move out of Context.cpp).
+  // Pools grow in slabs on demand, so start small for fast startup.
   _poolCluster.registerPool<Skybox>( 4 );
 
   _poolCluster.registerPool<DirectionalLight>( 2 );
   _poolCluster.registerPool<PointLight>( 16 );
   _poolCluster.registerPool<SpotLight>( 4 );
 
-  _poolCluster.registerPool<Box>( 20000 );
+  _poolCluster.registerPool<Box>( 1024 );
   _poolCluster.registerPool<Prefab>( 128 );
   _poolCluster.registerPool<Material>( 128 );
   _poolCluster.registerPool<Model>( 64 );
-  _poolCluster.registerPool<Node>( 20000 );
+  _poolCluster.registerPool<Node>( 1024 );
   _poolCluster.registerPool<Scene>( 4 );
   _poolCluster.registerPool<Sprite>( 32 );
   _poolCluster.registerPool<SpriteAnimationSet>( 8 );
   _poolCluster.registerPool<Textbox>( 8 );
 
-  // TODO: Parse pool/config settings from cfg file.
+  // Pool sizes and the worker count may be overridden by the config file
+  // passed to Create().
+  _jobSystem = std::make_unique<JobSystem>( _jobWorkerCount );
+
   Config::SetValue( "RenderAABBs", false );
   Config::SetValue( "shadows", true );
 
@@ -114,6 +122,76 @@ void Context::initConfiguration()
 
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
 
+void Context::loadConfigFile( const string& file )
+{
+  Serializer serializer;
+  if ( !serializer.deserialize( file ) ) {
+    LogWrite( Error, "Unable to load config file %s", file.c_str() );
+    return;
+  }
+
+  // Pools are keyed by type name, e.g.:
+  // "Pools": { "Node": { "Size": 4096, "Growth": "Doubling", "MaxSize": 65536 } }
+  const auto& pools = serializer.getValue( "Pools" );
+  for ( const auto& pair : pools.getValues() ) {
+    const string& typeName = pair.first;
+    const SerializerValue& settings = pair.second;
+
+    PoolConfig config;
+    const auto& size = settings.getValue( "Size" );
+    if ( !size.isNull() ) {
+      config.size = static_cast< size_t >( std::max( size.toInt(), 0 ) );
+    }
+
+    const auto& growth = settings.getValue( "Growth" );
+    if ( !growth.isNull() ) {
+      const string& mode = growth.toString();
+      if ( "Fixed" == mode ) {
+        config.growthPolicy.mode = PoolGrowthPolicy::Mode::Fixed;
+      }
+      else if ( "Linear" == mode ) {
+        config.growthPolicy.mode = PoolGrowthPolicy::Mode::Linear;
+      }
+      else if ( "Doubling" == mode ) {
+        config.growthPolicy.mode = PoolGrowthPolicy::Mode::Doubling;
+      }
+      else {
+        LogWrite( Warning, "Unknown growth mode %s for pool %s", mode.c_str(), typeName.c_str() );
+      }
+      config.overrideGrowthPolicy = true;
+    }
+
+    const auto& slabSize = settings.getValue( "SlabSize" );
+    if ( !slabSize.isNull() ) {
+      config.growthPolicy.slabSize = static_cast< size_t >( std::max( slabSize.toInt(), 0 ) );
+      config.overrideGrowthPolicy = true;
+    }
+
+    const auto& maxSize = settings.getValue( "MaxSize" );
+    if ( !maxSize.isNull() ) {
+      config.growthPolicy.maxSize = static_cast< size_t >( std::max( maxSize.toInt(), 0 ) );
+      config.overrideGrowthPolicy = true;
+    }
+
+    const auto& hugePages = settings.getValue( "HugePages" );
+    if ( !hugePages.isNull() ) {
+      config.growthPolicy.hugePages = hugePages.toBool();
+      config.overrideGrowthPolicy = true;
+    }
+
+    _poolCluster.setPoolConfig( typeName, config );
+    LogWrite( Info, "Loaded pool config for %s", typeName.c_str() );
+  }
+
+  // "Jobs": { "Workers": 3 }
+  const auto& workers = serializer.getValue( "Jobs" ).getValue( "Workers" );
+  if ( !workers.isNull() ) {
+    _jobWorkerCount = static_cast< uint32_t >( std::max( workers.toInt(), 0 ) );
+  }
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
 void Context::renderFrame( const real lagMultiplier )
 {
   _frameListenerController->frameStarted();
@@ -126,6 +204,9 @@ void Context::renderFrame( const real lagMultiplier )
   }
 
   _frameListenerController->frameEnded();
+
+  // All per-frame data is gone by now, reclaim it in one go.
+  _frameArena.reset();
 }
 
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
@@ -267,6 +348,13 @@ InputControllerPtr Context::getInputController() const
 
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
 
+JobSystem* Context::getJobSystem() const
+{
+  return _jobSystem.get();
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
 void Context::setActiveWindow( WindowPtr window )
 {
   _activeWindow = window;
@@ -282,7 +370,7 @@ void Context::setActiveWindow( const string& name )
 
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
 
-std::unique_ptr<Context> Context::Create( const RenderPlugin& renderer )
+std::unique_ptr<Context> Context::Create( const RenderPlugin& renderer, const string& configFile )
 {
   if ( _activeContextPtr ) {
     throw Lore::Exception( "A Lore context already exists for this process!" );
@@ -318,9 +406,13 @@ std::unique_ptr<Context> Context::Create( const RenderPlugin& renderer )
   Resource::AssignContext( context.get() );
   StockResource::AssignContext( context.get() );
   MemoryAccess::_SetPrimaryPoolCluster( &context->_poolCluster );
+  MemoryAccess::_SetFrameArena( &context->_frameArena );
   _activeContextPtr = context.get();
 
   // Apply configuration settings or use defaults.
+  if ( !configFile.empty() ) {
+    context->loadConfigFile( configFile );
+  }
   context->initConfiguration();
 
   return std::move( context );
@@ -337,6 +429,7 @@ void Context::Destroy( std::unique_ptr<Context> context )
   Resource::AssignContext( nullptr );
   StockResource::AssignContext( nullptr );
   MemoryAccess::_SetPrimaryPoolCluster( nullptr );
+  MemoryAccess::_SetFrameArena( nullptr );
   Log::Delete();
   NotificationCenter::Destroy();
   _activeContextPtr = nullptr;
@@ -393,6 +486,13 @@ WindowPtr Context::GetActiveWindow()
 
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
 
+JobSystem* Context::GetJobSystem()
+{
+  return ( _activeContextPtr ) ? _activeContextPtr->getJobSystem() : nullptr;
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
 void Context::onKeyDown( const Keycode code )
 {
   switch ( code ) {
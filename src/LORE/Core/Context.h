@@ -25,10 +25,12 @@
 // THE SOFTWARE.
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
 
+#include <LORE/Core/JobSystem.h>
 #include <LORE/Core/NotificationCenter.h>
 #include <LORE/Core/Plugin/Plugins.h>
 #include <LORE/Core/Plugin/RenderPluginLoader.h>
 #include <LORE/Input/Input.h>
+#include <LORE/Memory/FrameArena.h>
 #include <LORE/Memory/PoolCluster.h>
 #include <LORE/Renderer/FrameListener/FrameListenerController.h>
 #include <LORE/Renderer/Renderer.h>
@@ -58,6 +60,7 @@ namespace Lore {
   protected:
 
     PoolCluster _poolCluster { "Primary" };
+    FrameArena _frameArena {};
     std::unique_ptr<FrameListenerController> _frameListenerController { std::make_unique<FrameListenerController>() };
 
     WindowRegistry _windowRegistry {};
@@ -71,6 +74,10 @@ namespace Lore {
     std::unique_ptr<InputController> _inputController { nullptr };
     std::unique_ptr<IRenderAPI> _renderAPI { nullptr };
 
+    // Worker threads shared by engine systems, started in initConfiguration().
+    std::unique_ptr<JobSystem> _jobSystem { nullptr };
+    uint32_t _jobWorkerCount { JobSystem::GetDefaultWorkerCount() };
+
     // True if one or more Windows exist in Context.
     bool _active { false };
 
@@ -88,6 +95,12 @@ namespace Lore {
     ///     Context object can know the rendering API version.
     void setAPIVersion( const int major, const int minor );
 
+    ///
+    /// \brief Loads settings from a JSON configuration file. Must be called
+    ///     before initConfiguration(), so pool overrides apply when pools are
+    ///     registered.
+    void loadConfigFile( const string& file );
+
     ///
     /// \brief Called on a render plugin error. Notifies all registered listeners.
     static void ErrorCallback( int error, const char* desc );
@@ -221,7 +234,7 @@ namespace Lore {
     ///
     /// \brief Returns pointer to Scene in Context of the specified name.
     ///     Throws ItemIdentityException if not found.
-    ScenePtr getScene( const string& name )
+    ScenePtr getScene( const StringId& name )
     {
       return _sceneRegistry.get( name );
     }
@@ -230,6 +243,10 @@ namespace Lore {
     /// \brief Returns InputController instance allocated by render plugin's Context.
     InputControllerPtr getInputController() const;
 
+    ///
+    /// \brief Returns the JobSystem used to spread engine work across threads.
+    JobSystem* getJobSystem() const;
+
     //
     // Modifiers.
 
@@ -255,9 +272,11 @@ namespace Lore {
 
     ///
     /// \brief Creates a new Context instance and loads the specified render plugin.
+    ///     If configFile is provided, settings in it (such as memory pool sizes)
+    ///     override the defaults.
     /// \return A std::unique_ptr containing the Context. The caller should maintain
     ///     the pointer until it is no longer needed and pass it to Context::Destroy().
-    static std::unique_ptr<Context> Create( const RenderPlugin& renderPlugin );
+    static std::unique_ptr<Context> Create( const RenderPlugin& renderPlugin, const string& configFile = "" );
 
     ///
     /// \brief Frees all associated memory and GPU resources of Context.
@@ -291,6 +310,11 @@ namespace Lore {
     /// \brief Returns active window.
     static WindowPtr GetActiveWindow();
 
+    ///
+    /// \brief Returns the active Context's JobSystem, or nullptr if no
+    ///     Context is active.
+    static JobSystem* GetJobSystem();
+
     //
     // Deleted functions/operators.
 
@@ -305,9 +329,9 @@ namespace Lore {
 
   ///
   /// \copydoc Context::Create()
-  inline LORE_EXPORT std::unique_ptr<Context> CreateContext( const RenderPlugin& renderPlugin )
+  inline LORE_EXPORT std::unique_ptr<Context> CreateContext( const RenderPlugin& renderPlugin, const string& configFile = "" )
   {
-    return Context::Create( renderPlugin );
+    return Context::Create( renderPlugin, configFile );
   }
 
   ///
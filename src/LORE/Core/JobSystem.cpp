@@ -0,0 +1,254 @@
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+// The MIT License (MIT)
+// This source file is part of LORE
+// ( Lightweight Object-oriented Rendering Engine )
+//
+// Copyright (c) 2017-2021 Jordan Sparks
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files ( the "Software" ), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+#include "JobSystem.h"
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+using namespace Lore;
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+namespace LocalNS {
+
+  // The job system and queue owned by the current thread, if it is a worker.
+  static thread_local const JobSystem* __workerSystem = nullptr;
+  static thread_local uint32_t __workerQueue = 0;
+
+}
+using namespace LocalNS;
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+JobSystem::JobSystem( const uint32_t workerCount )
+{
+  for ( uint32_t i = 0; i <= workerCount; ++i ) {
+    _queues.push_back( std::make_unique<Queue>() );
+  }
+
+  _workers.reserve( workerCount );
+  for ( uint32_t i = 0; i < workerCount; ++i ) {
+    _workers.emplace_back( &JobSystem::_workerLoop, this, i + 1 );
+  }
+
+  LogWrite( Info, "Job system started with %u worker threads", workerCount );
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+JobSystem::~JobSystem()
+{
+  _running.store( false, std::memory_order_release );
+  {
+    std::lock_guard<std::mutex> lock( _sleepMutex );
+  }
+  _wake.notify_all();
+
+  for ( auto& worker : _workers ) {
+    worker.join();
+  }
+
+  // Finish anything still queued so no counter is left pending.
+  while ( _runOne() ) {
+  }
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+void JobSystem::run( JobFunction job, Counter& counter )
+{
+  counter._pending.fetch_add( 1, std::memory_order_relaxed );
+
+  auto& queue = *_queues[_getQueueIndex()];
+  {
+    std::lock_guard<std::mutex> lock( queue.mutex );
+    queue.jobs.push_back( { std::move( job ), &counter } );
+  }
+  _queued.fetch_add( 1, std::memory_order_release );
+
+  // Taking the lock orders this with a worker about to sleep, so the wake
+  // cannot be missed.
+  {
+    std::lock_guard<std::mutex> lock( _sleepMutex );
+  }
+  _wake.notify_one();
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+void JobSystem::wait( Counter& counter )
+{
+  while ( !counter.done() ) {
+    if ( !_runOne() ) {
+      std::this_thread::yield();
+    }
+  }
+
+  // Every job has finished, so nothing else touches the exception now. Reset
+  // the counter so it can be reused after the caller handles the failure.
+  if ( counter._failed.load( std::memory_order_acquire ) ) {
+    std::exception_ptr exception = std::move( counter._exception );
+    counter._exception = nullptr;
+    counter._failed.store( false, std::memory_order_relaxed );
+    std::rethrow_exception( exception );
+  }
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+void JobSystem::parallelFor( const size_t begin,
+                             const size_t end,
+                             const size_t grainSize,
+                             const RangeFunction& body )
+{
+  if ( end <= begin ) {
+    return;
+  }
+
+  const size_t grain = std::max( grainSize, static_cast< size_t >( 1 ) );
+  if ( end - begin <= grain ) {
+    body( begin, end );
+    return;
+  }
+
+  Counter counter;
+  for ( size_t chunk = begin; chunk < end; chunk += grain ) {
+    const size_t chunkEnd = std::min( chunk + grain, end );
+    run( [&body, chunk, chunkEnd] {
+      body( chunk, chunkEnd );
+    }, counter );
+  }
+  wait( counter );
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+uint32_t JobSystem::GetDefaultWorkerCount()
+{
+  const uint32_t hardwareThreads = std::thread::hardware_concurrency();
+  return ( hardwareThreads > 1 ) ? hardwareThreads - 1 : 0;
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+uint32_t JobSystem::_getQueueIndex() const
+{
+  return ( this == __workerSystem ) ? __workerQueue : 0;
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+bool JobSystem::_pop( const uint32_t queueIndex, Job& job )
+{
+  auto& queue = *_queues[queueIndex];
+  std::lock_guard<std::mutex> lock( queue.mutex );
+  if ( queue.jobs.empty() ) {
+    return false;
+  }
+
+  // Newest first from our own queue, its data is most likely still in cache.
+  job = std::move( queue.jobs.back() );
+  queue.jobs.pop_back();
+  _queued.fetch_sub( 1, std::memory_order_relaxed );
+  return true;
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+bool JobSystem::_steal( const uint32_t queueIndex, Job& job )
+{
+  const uint32_t count = static_cast< uint32_t >( _queues.size() );
+  for ( uint32_t i = 1; i < count; ++i ) {
+    auto& queue = *_queues[( queueIndex + i ) % count];
+    std::lock_guard<std::mutex> lock( queue.mutex );
+    if ( !queue.jobs.empty() ) {
+      // Oldest first from other queues, leaving the owner its recent work.
+      job = std::move( queue.jobs.front() );
+      queue.jobs.pop_front();
+      _queued.fetch_sub( 1, std::memory_order_relaxed );
+      return true;
+    }
+  }
+
+  return false;
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+bool JobSystem::_runOne()
+{
+  const uint32_t queueIndex = _getQueueIndex();
+
+  Job job;
+  if ( _pop( queueIndex, job ) || _steal( queueIndex, job ) ) {
+    _execute( job );
+    return true;
+  }
+
+  return false;
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+void JobSystem::_execute( Job& job )
+{
+  // Letting an exception escape would terminate a worker thread, keep the
+  // first one for whoever waits on the counter instead.
+  try {
+    job.function();
+  }
+  catch ( ... ) {
+    bool expected = false;
+    if ( job.counter->_failed.compare_exchange_strong( expected, true, std::memory_order_relaxed ) ) {
+      job.counter->_exception = std::current_exception();
+    }
+  }
+
+  job.counter->_pending.fetch_sub( 1, std::memory_order_acq_rel );
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+void JobSystem::_workerLoop( const uint32_t queueIndex )
+{
+  __workerSystem = this;
+  __workerQueue = queueIndex;
+
+  while ( _running.load( std::memory_order_acquire ) ) {
+    if ( _runOne() ) {
+      continue;
+    }
+
+    std::unique_lock<std::mutex> lock( _sleepMutex );
+    _wake.wait( lock, [this] {
+      return ( !_running.load( std::memory_order_acquire ) ||
+               _queued.load( std::memory_order_acquire ) > 0 );
+    } );
+  }
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
@@ -0,0 +1,159 @@
+#pragma once
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+// The MIT License (MIT)
+// This source file is part of LORE
+// ( Lightweight Object-oriented Rendering Engine )
+//
+// Copyright (c) 2017-2021 Jordan Sparks
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files ( the "Software" ), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+#include <deque>
+#include <exception>
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+namespace Lore {
+
+  ///
+  /// \class JobSystem
+  /// \brief Runs jobs on a fixed set of worker threads using per-thread
+  ///     work-stealing deques.
+  /// \details Each worker pushes and pops jobs at the back of its own deque
+  ///     and steals from the front of the others' when it runs dry. Threads
+  ///     that are not workers share one extra deque. Every job belongs to a
+  ///     Counter, which wait() blocks on while helping to run queued jobs, so
+  ///     a job may spawn child jobs on its own Counter and wait for them
+  ///     without deadlocking the pool.
+  class LORE_EXPORT JobSystem final
+  {
+
+  public:
+
+    using JobFunction = std::function<void()>;
+    using RangeFunction = std::function<void( const size_t begin, const size_t end )>;
+
+    ///
+    /// \class Counter
+    /// \brief Number of unfinished jobs in a group. Pass it to wait() to block
+    ///     until the group completes. The first exception thrown by a job in
+    ///     the group is kept and rethrown by wait().
+    class Counter final
+    {
+
+      friend class JobSystem;
+
+      std::atomic<uint32_t> _pending { 0 };
+
+      // Set once by the first failing job, before it decrements _pending.
+      std::atomic<bool> _failed { false };
+      std::exception_ptr _exception {};
+
+    public:
+
+      inline bool done() const
+      {
+        return ( 0 == _pending.load( std::memory_order_acquire ) );
+      }
+
+    };
+
+  private:
+
+    struct Job
+    {
+      JobFunction function {};
+      Counter* counter { nullptr };
+    };
+
+    struct Queue
+    {
+      std::mutex mutex {};
+      std::deque<Job> jobs {};
+    };
+
+    // Queue 0 is shared by all non-worker threads, worker N owns queue N + 1.
+    std::vector<std::unique_ptr<Queue>> _queues {};
+    std::vector<std::thread> _workers {};
+
+    std::atomic<bool> _running { true };
+
+    // Idle workers sleep until jobs are queued.
+    std::atomic<uint32_t> _queued { 0 };
+    std::mutex _sleepMutex {};
+    std::condition_variable _wake {};
+
+    // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+    uint32_t _getQueueIndex() const;
+    bool _pop( const uint32_t queueIndex, Job& job );
+    bool _steal( const uint32_t queueIndex, Job& job );
+    bool _runOne();
+    void _execute( Job& job );
+    void _workerLoop( const uint32_t queueIndex );
+
+  public:
+
+    ///
+    /// \brief Starts workerCount worker threads. With no workers, jobs are
+    ///     run by the threads that wait on them.
+    explicit JobSystem( const uint32_t workerCount = GetDefaultWorkerCount() );
+    ~JobSystem();
+
+    ///
+    /// \brief Queues job as part of counter's group.
+    void run( JobFunction job, Counter& counter );
+
+    ///
+    /// \brief Blocks until every job in counter's group has finished,
+    ///     running queued jobs on this thread in the meantime. Rethrows the
+    ///     first exception thrown by a job in the group, once all are done.
+    void wait( Counter& counter );
+
+    ///
+    /// \brief Splits [begin, end) into chunks of at most grainSize items,
+    ///     runs body on each chunk in parallel, and returns once all are done.
+    /// \details Ranges no larger than one grain run inline on the caller.
+    ///     Rethrows the first exception thrown by body.
+    void parallelFor( const size_t begin,
+                      const size_t end,
+                      const size_t grainSize,
+                      const RangeFunction& body );
+
+    inline uint32_t getWorkerCount() const
+    {
+      return static_cast< uint32_t >( _workers.size() );
+    }
+
+    ///
+    /// \brief One worker per hardware thread, leaving one for the main thread.
+    static uint32_t GetDefaultWorkerCount();
+
+    //
+    // Deleted functions/operators.
+
+    JobSystem( const JobSystem& rhs ) = delete;
+    JobSystem& operator = ( const JobSystem& rhs ) = delete;
+
+  };
+
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
@@ -0,0 +1,191 @@
+#pragma once
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+// The MIT License (MIT)
+// This source file is part of LORE
+// ( Lightweight Object-oriented Rendering Engine )
+//
+// Copyright (c) 2017-2021 Jordan Sparks
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files ( the "Software" ), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+#include <limits>
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+namespace Lore {
+
+  ///
+  /// \struct BoundingBox
+  /// \brief An axis-aligned box in 3D. A default constructed box is empty
+  ///     and grows as points or other boxes are merged into it.
+  struct BoundingBox
+  {
+
+    glm::vec3 min { std::numeric_limits<real>::max() };
+    glm::vec3 max { std::numeric_limits<real>::lowest() };
+
+    BoundingBox() = default;
+    BoundingBox( const glm::vec3& min_,
+                 const glm::vec3& max_ )
+      : min( min_ )
+      , max( max_ )
+    { }
+
+    bool isEmpty() const
+    {
+      return ( min.x > max.x || min.y > max.y || min.z > max.z );
+    }
+
+    glm::vec3 getCenter() const
+    {
+      return ( min + max ) * 0.5f;
+    }
+
+    ///
+    /// \brief Returns the half size of the box on each axis.
+    glm::vec3 getExtents() const
+    {
+      return ( max - min ) * 0.5f;
+    }
+
+    void merge( const glm::vec3& point )
+    {
+      min = glm::min( min, point );
+      max = glm::max( max, point );
+    }
+
+    void merge( const BoundingBox& rhs )
+    {
+      if ( !rhs.isEmpty() ) {
+        min = glm::min( min, rhs.min );
+        max = glm::max( max, rhs.max );
+      }
+    }
+
+    bool contains( const glm::vec3& point ) const
+    {
+      return ( point.x >= min.x && point.x <= max.x &&
+               point.y >= min.y && point.y <= max.y &&
+               point.z >= min.z && point.z <= max.z );
+    }
+
+    bool intersects( const BoundingBox& rhs ) const
+    {
+      return !( rhs.min.x > max.x || rhs.max.x < min.x ||
+                rhs.min.y > max.y || rhs.max.y < min.y ||
+                rhs.min.z > max.z || rhs.max.z < min.z );
+    }
+
+    ///
+    /// \brief Returns the box enclosing this box after transformation by m
+    ///     (Arvo's method), without transforming all eight corners.
+    BoundingBox transform( const glm::mat4& m ) const
+    {
+      if ( isEmpty() ) {
+        return *this;
+      }
+
+      BoundingBox result;
+      for ( int i = 0; i < 3; ++i ) {
+        // Start from the translation and add the smaller and larger
+        // contribution of each axis.
+        result.min[i] = result.max[i] = m[3][i];
+        for ( int j = 0; j < 3; ++j ) {
+          const real a = m[j][i] * min[j];
+          const real b = m[j][i] * max[j];
+          result.min[i] += std::min( a, b );
+          result.max[i] += std::max( a, b );
+        }
+      }
+
+      return result;
+    }
+
+  };
+
+  // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+  ///
+  /// \struct BoundingSphere
+  /// \brief A sphere enclosing a set of points. A negative radius means the
+  ///     sphere is empty.
+  struct BoundingSphere
+  {
+
+    glm::vec3 center { 0.f };
+    real radius { -1.f };
+
+    BoundingSphere() = default;
+    BoundingSphere( const glm::vec3& center_,
+                    const real radius_ )
+      : center( center_ )
+      , radius( radius_ )
+    { }
+
+    bool isEmpty() const
+    {
+      return ( radius < 0.f );
+    }
+
+    ///
+    /// \brief Grows the sphere to also enclose rhs.
+    void merge( const BoundingSphere& rhs )
+    {
+      if ( rhs.isEmpty() ) {
+        return;
+      }
+      if ( isEmpty() ) {
+        *this = rhs;
+        return;
+      }
+
+      const glm::vec3 offset = rhs.center - center;
+      const real distance = glm::length( offset );
+      if ( distance + rhs.radius <= radius ) {
+        return; // Already enclosed.
+      }
+      if ( distance + radius <= rhs.radius ) {
+        *this = rhs;
+        return;
+      }
+
+      const real newRadius = ( distance + radius + rhs.radius ) * 0.5f;
+      center += offset * ( ( newRadius - radius ) / distance );
+      radius = newRadius;
+    }
+
+    bool intersects( const BoundingSphere& rhs ) const
+    {
+      const real r = radius + rhs.radius;
+      return ( glm::length2( rhs.center - center ) <= r * r );
+    }
+
+    bool intersects( const BoundingBox& box ) const
+    {
+      // Distance from the center to the closest point in the box.
+      const glm::vec3 closest = glm::min( glm::max( center, box.min ), box.max );
+      return ( glm::length2( closest - center ) <= radius * radius );
+    }
+
+  };
+
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
@@ -0,0 +1,142 @@
+#pragma once
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+// The MIT License (MIT)
+// This source file is part of LORE
+// ( Lightweight Object-oriented Rendering Engine )
+//
+// Copyright (c) 2017-2021 Jordan Sparks
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files ( the "Software" ), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+#include <array>
+
+#include "Bounds.h"
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+namespace Lore {
+
+  ///
+  /// \struct Frustum
+  /// \brief The six clipping planes of a view-projection matrix, used to
+  ///     reject bounding volumes that cannot be seen.
+  /// \details Planes are stored as ( normal, distance ) with normals pointing
+  ///     into the frustum, so a point p is inside a plane when
+  ///     dot( normal, p ) + distance >= 0.
+  struct Frustum
+  {
+
+    enum Plane
+    {
+      Left,
+      Right,
+      Bottom,
+      Top,
+      Near,
+      Far,
+
+      PlaneCount
+    };
+
+    std::array<glm::vec4, PlaneCount> planes {};
+
+    Frustum() = default;
+    explicit Frustum( const glm::mat4& viewProjection )
+    {
+      update( viewProjection );
+    }
+
+    ///
+    /// \brief Extracts the planes from a view-projection matrix (Gribb and
+    ///     Hartmann), assuming OpenGL clip space.
+    void update( const glm::mat4& m )
+    {
+      // glm matrices are column-major, so gather each row across columns.
+      const glm::vec4 row0( m[0][0], m[1][0], m[2][0], m[3][0] );
+      const glm::vec4 row1( m[0][1], m[1][1], m[2][1], m[3][1] );
+      const glm::vec4 row2( m[0][2], m[1][2], m[2][2], m[3][2] );
+      const glm::vec4 row3( m[0][3], m[1][3], m[2][3], m[3][3] );
+
+      planes[Left] = row3 + row0;
+      planes[Right] = row3 - row0;
+      planes[Bottom] = row3 + row1;
+      planes[Top] = row3 - row1;
+      planes[Near] = row3 + row2;
+      planes[Far] = row3 - row2;
+
+      // Normalize so sphere radii can be compared against plane distances.
+      for ( auto& plane : planes ) {
+        plane /= glm::length( glm::vec3( plane ) );
+      }
+    }
+
+    bool intersectsSphere( const glm::vec3& center, const real radius ) const
+    {
+      for ( const auto& plane : planes ) {
+        if ( glm::dot( glm::vec3( plane ), center ) + plane.w < -radius ) {
+          return false;
+        }
+      }
+
+      return true;
+    }
+
+    ///
+    /// \brief Returns true if box lies entirely inside the frustum.
+    bool containsAABB( const BoundingBox& box ) const
+    {
+      for ( const auto& plane : planes ) {
+        // Test the corner furthest against the plane normal.
+        const glm::vec3 corner( ( plane.x >= 0.f ) ? box.min.x : box.max.x,
+                                ( plane.y >= 0.f ) ? box.min.y : box.max.y,
+                                ( plane.z >= 0.f ) ? box.min.z : box.max.z );
+        if ( glm::dot( glm::vec3( plane ), corner ) + plane.w < 0.f ) {
+          return false;
+        }
+      }
+
+      return true;
+    }
+
+    bool intersectsAABB( const BoundingBox& box ) const
+    {
+      return intersectsAABB( box.min, box.max );
+    }
+
+    bool intersectsAABB( const glm::vec3& min, const glm::vec3& max ) const
+    {
+      for ( const auto& plane : planes ) {
+        // Test the corner furthest along the plane normal.
+        const glm::vec3 corner( ( plane.x >= 0.f ) ? max.x : min.x,
+                                ( plane.y >= 0.f ) ? max.y : min.y,
+                                ( plane.z >= 0.f ) ? max.z : min.z );
+        if ( glm::dot( glm::vec3( plane ), corner ) + plane.w < 0.f ) {
+          return false;
+        }
+      }
+
+      return true;
+    }
+
+  };
+
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
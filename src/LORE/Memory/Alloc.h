@@ -46,11 +46,6 @@ namespace Lore {
 
   public:
 
-    std::atomic<bool> inUse { false };
-    T* next { nullptr };
-
-    // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
-
     Alloc() = default;
     virtual ~Alloc() = default;
 
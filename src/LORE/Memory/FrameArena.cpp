@@ -0,0 +1,129 @@
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+// The MIT License (MIT)
+// This source file is part of LORE
+// ( Lightweight Object-oriented Rendering Engine )
+//
+// Copyright (c) 2017-2021 Jordan Sparks
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files ( the "Software" ), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+#include "FrameArena.h"
+
+#include <LORE/Memory/SlabAllocator.h>
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+using namespace Lore;
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+FrameArena::FrameArena( const size_t blockSize )
+: _blockSize( std::max( blockSize, SlabAllocator::CacheLineSize ) )
+{
+  _addBlock( _blockSize );
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+FrameArena::~FrameArena()
+{
+  _freeBlocks();
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+void* FrameArena::allocate( const size_t bytes, const size_t alignment )
+{
+  assert( alignment && 0 == ( alignment & ( alignment - 1 ) ) );
+
+  while ( true ) {
+    Block& block = _blocks[_current];
+    const size_t aligned = ( _offset + alignment - 1 ) & ~( alignment - 1 );
+    if ( aligned + bytes <= block.size ) {
+      _usedBytes += ( aligned - _offset ) + bytes;
+      _offset = aligned + bytes;
+      return block.data + aligned;
+    }
+
+    // Move on to the next block, chaining a new one if this frame has
+    // outgrown every block so far.
+    _usedBytes += block.size - _offset;
+    if ( _current + 1 == _blocks.size() ) {
+      _addBlock( bytes + alignment );
+    }
+    ++_current;
+    _offset = 0;
+  }
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+void FrameArena::reset()
+{
+  _highWaterMark = std::max( _highWaterMark, _usedBytes );
+
+  // Coalesce into one block big enough for the largest frame seen, so the
+  // next frame is served from a single block without touching the heap.
+  if ( _blocks.size() > 1 ) {
+    const size_t size = ( ( _highWaterMark + _blockSize - 1 ) / _blockSize ) * _blockSize;
+    LogWrite( Info, "Frame arena coalescing %llu blocks into %llu bytes", TO_LLU( _blocks.size() ), TO_LLU( size ) );
+    _freeBlocks();
+    _addBlock( size );
+  }
+
+  _current = 0;
+  _offset = 0;
+  _usedBytes = 0;
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+size_t FrameArena::getCapacity() const
+{
+  size_t capacity = 0;
+  for ( const auto& block : _blocks ) {
+    capacity += block.size;
+  }
+  return capacity;
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+void FrameArena::_addBlock( const size_t minimumSize )
+{
+  Block block;
+  block.size = std::max( minimumSize, _blockSize );
+  bool hugePages = false;
+  block.data = static_cast<unsigned char*>( SlabAllocator::Allocate( block.size, SlabAllocator::CacheLineSize, hugePages ) );
+  _blocks.push_back( block );
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+void FrameArena::_freeBlocks()
+{
+  for ( const auto& block : _blocks ) {
+    SlabAllocator::Free( block.data, block.size, false );
+  }
+  _blocks.clear();
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
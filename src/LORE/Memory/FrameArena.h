@@ -0,0 +1,207 @@
+#pragma once
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+// The MIT License (MIT)
+// This source file is part of LORE
+// ( Lightweight Object-oriented Rendering Engine )
+//
+// Copyright (c) 2017-2021 Jordan Sparks
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files ( the "Software" ), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+#include <LORE/Memory/MemoryAccess.h>
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+namespace Lore {
+
+  ///
+  /// \class FrameArena
+  /// \brief Linear (bump) allocator for data which only lives for a single
+  ///     frame, such as render queues. Individual allocations are never
+  ///     freed, instead the whole arena is reset once the frame has ended.
+  /// \details If a frame outgrows the current block, further blocks are
+  ///     chained on. On the next reset the blocks are coalesced into a single
+  ///     block large enough for that frame, so steady-state frames do not
+  ///     touch the heap at all. Not thread-safe, intended for the render thread.
+  class LORE_EXPORT FrameArena final
+  {
+
+    struct Block
+    {
+      unsigned char* data { nullptr };
+      size_t size { 0 };
+    };
+
+    using BlockList = std::vector<Block>;
+
+    // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+    BlockList _blocks {};
+    size_t _current { 0 };
+    size_t _offset { 0 };
+    size_t _blockSize { 0 };
+
+    // Bytes handed out this frame, including alignment padding.
+    size_t _usedBytes { 0 };
+    size_t _highWaterMark { 0 };
+
+    // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+    void _addBlock( const size_t minimumSize );
+
+    void _freeBlocks();
+
+  public:
+
+    static constexpr const size_t DefaultBlockSize = 256 * 1024;
+
+    // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+    explicit FrameArena( const size_t blockSize = DefaultBlockSize );
+
+    ~FrameArena();
+
+    ///
+    /// \brief Returns uninitialized memory which stays valid until reset().
+    void* allocate( const size_t bytes, const size_t alignment );
+
+    ///
+    /// \brief Reclaims all memory handed out since the last reset. Anything
+    ///     still referencing arena memory must be gone by this point.
+    void reset();
+
+    //
+    // Information.
+
+    inline size_t getUsedBytes() const
+    {
+      return _usedBytes;
+    }
+
+    inline size_t getHighWaterMark() const
+    {
+      return _highWaterMark;
+    }
+
+    size_t getCapacity() const;
+
+    inline size_t getBlockCount() const
+    {
+      return _blocks.size();
+    }
+
+    //
+    // Deleted functions/operators.
+
+    FrameArena( const FrameArena& rhs ) = delete;
+    FrameArena& operator = ( const FrameArena& rhs ) = delete;
+
+  };
+
+  // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+  ///
+  /// \class FrameAllocator
+  /// \brief STL-compatible allocator which draws from a FrameArena. Default
+  ///     constructed allocators use the Context's frame arena.
+  /// \details Deallocation is a no-op, so containers using this allocator must
+  ///     be destroyed or released before the arena is reset, and must not be
+  ///     created before the frame they are used in (some standard libraries
+  ///     allocate in container constructors).
+  template<typename T>
+  class FrameAllocator
+  {
+
+    template<typename U>
+    friend class FrameAllocator;
+
+    FrameArena* _arena { nullptr };
+
+  public:
+
+    using value_type = T;
+
+    using propagate_on_container_copy_assignment = std::true_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+
+    // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+    FrameAllocator() noexcept
+    : _arena( MemoryAccess::GetFrameArena() )
+    { }
+
+    explicit FrameAllocator( FrameArena* arena ) noexcept
+    : _arena( arena )
+    { }
+
+    template<typename U>
+    FrameAllocator( const FrameAllocator<U>& rhs ) noexcept
+    : _arena( rhs._arena )
+    { }
+
+    inline T* allocate( const size_t n )
+    {
+      assert( _arena );
+      return static_cast<T*>( _arena->allocate( sizeof( T ) * n, alignof( T ) ) );
+    }
+
+    inline void deallocate( T*, const size_t ) noexcept
+    { }
+
+    inline FrameArena* getArena() const
+    {
+      return _arena;
+    }
+
+    template<typename U>
+    inline bool operator == ( const FrameAllocator<U>& rhs ) const
+    {
+      return ( _arena == rhs._arena );
+    }
+
+    template<typename U>
+    inline bool operator != ( const FrameAllocator<U>& rhs ) const
+    {
+      return ( _arena != rhs._arena );
+    }
+
+  };
+
+  // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+  //
+  // Containers for per-frame data.
+
+  template<typename T>
+  using FrameVector = std::vector<T, FrameAllocator<T>>;
+
+  template<typename K, typename V, typename Compare = std::less<K>>
+  using FrameMap = std::map<K, V, Compare, FrameAllocator<std::pair<const K, V>>>;
+
+  template<typename K, typename V, typename Compare = std::less<K>>
+  using FrameMultiMap = std::multimap<K, V, Compare, FrameAllocator<std::pair<const K, V>>>;
+
+  template<typename T, typename Hash = std::hash<T>, typename Equal = std::equal_to<T>>
+  using FrameUnorderedSet = std::unordered_set<T, Hash, Equal, FrameAllocator<T>>;
+
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
@@ -0,0 +1,95 @@
+#pragma once
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+// The MIT License (MIT)
+// This source file is part of LORE
+// ( Lightweight Object-oriented Rendering Engine )
+//
+// Copyright (c) 2017-2021 Jordan Sparks
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files ( the "Software" ), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+namespace Lore {
+
+  ///
+  /// \struct Handle
+  /// \brief Weak reference to an object in a MemoryPool, made of the object's
+  ///     slot index and the generation of that slot when the handle was taken.
+  /// \details The generation of a slot is bumped each time an object is
+  ///     created or destroyed in it, so a handle to an object which has since
+  ///     been destroyed (or whose slot was reused) no longer resolves. Unlike
+  ///     raw pointers, handles do not depend on where the object lives, so
+  ///     pools are free to relocate objects in the future.
+  template<typename T>
+  struct Handle
+  {
+
+    static constexpr const u32 InvalidIndex = ~u32( 0 );
+
+    u32 index { InvalidIndex };
+    u32 generation { 0 };
+
+    // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+    Handle() = default;
+
+    Handle( const u32 index_, const u32 generation_ )
+    : index( index_ )
+    , generation( generation_ )
+    { }
+
+    ///
+    /// \brief Allows implicit conversion from handles of derived types.
+    template<typename U, typename = typename std::enable_if<std::is_convertible<U*, T*>::value>::type>
+    Handle( const Handle<U>& rhs )
+    : index( rhs.index )
+    , generation( rhs.generation )
+    { }
+
+    ///
+    /// \brief Returns true if this handle was never assigned. A non-null
+    ///     handle may still be stale, resolve it through its pool to check.
+    inline bool isNull() const
+    {
+      return ( InvalidIndex == index );
+    }
+
+    inline bool operator == ( const Handle& rhs ) const
+    {
+      return ( index == rhs.index && generation == rhs.generation );
+    }
+
+    inline bool operator != ( const Handle& rhs ) const
+    {
+      return !( *this == rhs );
+    }
+
+    inline bool operator < ( const Handle& rhs ) const
+    {
+      return ( index < rhs.index ) || ( index == rhs.index && generation < rhs.generation );
+    }
+
+  };
+
+  using NodeHandle = Handle<Node>;
+  using PrefabHandle = Handle<Prefab>;
+
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
@@ -35,6 +35,7 @@ using namespace Lore;
 namespace MemoryAccessNS {
 
     static PoolCluster* PrimaryPoolCluster;
+    static FrameArena* PrimaryFrameArena;
 
 }
 using namespace MemoryAccessNS;
@@ -54,3 +55,17 @@ void MemoryAccess::_SetPrimaryPoolCluster( PoolCluster* pc )
 }
 
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+FrameArena* MemoryAccess::GetFrameArena()
+{
+    return PrimaryFrameArena;
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+void MemoryAccess::_SetFrameArena( FrameArena* arena )
+{
+    PrimaryFrameArena = arena;
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
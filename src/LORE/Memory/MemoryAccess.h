@@ -31,9 +31,12 @@
 
 namespace Lore {
 
+    class FrameArena;
+
     ///
     /// \class MemoryAccess
-    /// \brief Purely static method class for accessing the Context's pool cluster.
+    /// \brief Purely static method class for accessing the Context's pool cluster
+    ///     and frame arena.
     class LORE_EXPORT MemoryAccess final
     {
 
@@ -41,10 +44,17 @@ namespace Lore {
 
       static void _SetPrimaryPoolCluster( PoolCluster* pc );
 
+      static void _SetFrameArena( FrameArena* arena );
+
     public:
 
         static PoolCluster* GetPrimaryPoolCluster();
 
+        ///
+        /// \brief Returns the arena for data which only lives until the end
+        ///     of the current frame.
+        static FrameArena* GetFrameArena();
+
     };
 
 }
@@ -26,11 +26,76 @@
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
 
 #include <LORE/Memory/Alloc.h>
+#include <LORE/Memory/Handle.h>
+#include <LORE/Memory/SlabAllocator.h>
 
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
 
 namespace Lore {
 
+  ///
+  /// \struct PoolGrowthPolicy
+  /// \brief Describes how a MemoryPool grows once all of its objects are in use.
+  /// \details Growth always happens by chaining a new slab onto the pool, so
+  ///     addresses of existing objects never move.
+  struct PoolGrowthPolicy
+  {
+
+    enum class Mode
+    {
+      Fixed,    // Never grow, throw a MemoryException at capacity.
+      Linear,   // Grow by slabSize objects each time.
+      Doubling  // Grow by the current capacity each time.
+    };
+
+    Mode mode { Mode::Linear };
+
+    // Objects per new slab in Linear mode (0 uses the pool's initial size).
+    size_t slabSize { 0 };
+
+    // Hard cap on the total number of objects in the pool (0 is unbounded).
+    size_t maxSize { 0 };
+
+    // Back new slabs with huge pages where the platform supports it.
+    bool hugePages { false };
+
+  };
+
+  // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+  ///
+  /// \struct PoolStats
+  /// \brief Snapshot of a MemoryPool's occupancy and lifetime counters, used
+  ///     to size pools from real usage.
+  struct PoolStats
+  {
+
+    string name {};
+    size_t objectSize { 0 };
+
+    size_t totalObjects { 0 };
+    size_t activeObjects { 0 };
+
+    // Largest number of objects that were active at once.
+    size_t highWaterMark { 0 };
+
+    size_t allocations { 0 };
+    size_t deallocations { 0 };
+
+    // Creations that threw, either at maximum capacity or from a constructor.
+    size_t failures { 0 };
+
+    size_t slabs { 0 };
+
+    // Bytes held by the pool's slabs (including slot headers) versus bytes
+    // occupied by live objects.
+    size_t reservedBytes { 0 };
+    size_t liveBytes { 0 };
+
+  };
+
+  // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
   ///
   /// \class MemoryPoolBase
   /// \brief Non-template base class for MemoryPool, so instances can be
@@ -43,126 +108,486 @@ namespace Lore {
     virtual ~MemoryPoolBase() { }
 
     virtual void resize( const size_t newSize ) = 0;
+    virtual void setGrowthPolicy( const PoolGrowthPolicy& policy ) = 0;
     virtual void destroyAll() = 0;
+    virtual PoolStats getStats() const = 0;
 
   };
 
   // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
 
+  ///
+  /// \brief Selects whether a MemoryPool may be used from multiple threads.
+  enum class PoolThreading
+  {
+    Single,     // Plain free list, no synchronization.
+    Concurrent  // Lock-free free list, create() and destroy() may be called from any thread.
+  };
+
+  // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
   ///
   /// \class MemoryPool
   /// \brief Generic memory pool with O(1) creation/deletion time.
+  /// \details Objects are stored contiguously in a chain of cache-line aligned
+  ///     slabs. When the free list is exhausted a new slab is added according
+  ///     to the pool's growth policy. Slots hold raw storage until create()
+  ///     constructs an object in place, and destroy() destructs it again; the
+  ///     free list is threaded through the storage of unused slots.
+  ///
+  ///     Each slot carries a generation counter which is odd while an object
+  ///     is constructed in it. Handle<T> pairs a slot index with that
+  ///     generation, so stale references can be detected in O(1).
+  ///
+  ///     Concurrent pools use a Treiber stack with a tagged head pointer for
+  ///     the free list, and serialize growth with a mutex. Iteration and
+  ///     getObjectAt() must not overlap with creation on other threads.
   template<typename T>
   class MemoryPool final : public MemoryPoolBase
   {
 
-    using List = T**;
+    struct Slot
+    {
+      u32 generation { 0 };
+      u32 index { 0 };
+      alignas( T ) unsigned char storage[sizeof( T )];
+
+      inline bool active() const
+      {
+        return ( generation & 1 );
+      }
+
+      inline T* object()
+      {
+        return reinterpret_cast<T*>( storage );
+      }
+
+      // Unused slots store the free list link in place of the object.
+      inline Slot*& next()
+      {
+        return *reinterpret_cast<Slot**>( storage );
+      }
+    };
+
+    static_assert( sizeof( T ) >= sizeof( Slot* ), "Pooled type is too small to hold a free list link" );
+    static_assert( sizeof( void* ) == sizeof( u64 ), "Tagged free list pointers require a 64-bit platform" );
+
+    struct Slab
+    {
+      Slot* slots { nullptr };
+      size_t size { 0 };
+      size_t bytes { 0 };
+      bool hugePages { false };
+    };
+
+    using SlabList = std::vector<Slab>;
+
+    // The concurrent free list head packs a 48-bit pointer with a 16-bit tag
+    // that is bumped on every update, to avoid ABA problems.
+    static constexpr const u64 TagShift = 48;
+    static constexpr const u64 PointerMask = ( u64( 1 ) << TagShift ) - 1;
+
+    // Handle indices store the slab in the upper bits and the slot offset
+    // within that slab in the lower bits, so they resolve without a search.
+    static constexpr const u32 SlabShift = 20;
+    static constexpr const u32 OffsetMask = ( u32( 1 ) << SlabShift ) - 1;
+    static constexpr const size_t MaxSlabObjects = size_t( 1 ) << SlabShift;
+    static constexpr const size_t MaxSlabs = ( size_t( 1 ) << ( 32 - SlabShift ) ) - 1;
 
     // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
 
     string _name {};
     size_t _size { 0 };
+    size_t _initialSize { 0 };
     size_t _activeObjectCount { 0 };
-    List _objects {};
+    SlabList _slabs {};
+    PoolGrowthPolicy _growthPolicy {};
+    const PoolThreading _threading { PoolThreading::Single };
 
-    T* _next { nullptr };
+    Slot* _next { nullptr };
 
-  public:
+    std::atomic<u64> _head { 0 };
+    std::atomic<size_t> _concurrentActiveObjectCount { 0 };
+    std::mutex _growthMutex {};
 
-    inline MemoryPool( const string& name, const size_t size )
-      : _name( name )
-      , _size( size )
+    // Telemetry, only relaxed ordering is needed.
+    std::atomic<size_t> _allocationCount { 0 };
+    std::atomic<size_t> _deallocationCount { 0 };
+    std::atomic<size_t> _failureCount { 0 };
+    std::atomic<size_t> _highWaterMark { 0 };
+    size_t _reservedBytes { 0 };
+
+    // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+    ///
+    /// \brief Increments a telemetry counter. Single threaded pools avoid the
+    ///     locked read-modify-write.
+    inline void _count( std::atomic<size_t>& counter )
     {
-      // Allocate pool and each object.
-      _objects = new T*[_size];
-      for ( int i = 0; i < _size; ++i ) {
-        _objects[i] = new T();
+      if ( PoolThreading::Concurrent == _threading ) {
+        counter.fetch_add( 1, std::memory_order_relaxed );
+      }
+      else {
+        counter.store( counter.load( std::memory_order_relaxed ) + 1, std::memory_order_relaxed );
       }
+    }
 
-      // Setup linked list.
-      for ( int i = 0; i < _size - 1; ++i ) {
-        _objects[i]->next = _objects[i + 1];
+    inline void _updateHighWaterMark( const size_t active )
+    {
+      size_t highWaterMark = _highWaterMark.load( std::memory_order_relaxed );
+      while ( active > highWaterMark &&
+              !_highWaterMark.compare_exchange_weak( highWaterMark, active, std::memory_order_relaxed ) ) {
       }
+    }
 
-      // Setup head and tail.
-      _next = _objects[0];
-      _objects[_size - 1]->next = nullptr;
+    static inline Slot* _slotOf( T* object )
+    {
+      return reinterpret_cast<Slot*>( reinterpret_cast<unsigned char*>( object ) - offsetof( Slot, storage ) );
     }
 
-    inline virtual ~MemoryPool() override
+    static inline Slot* _untag( const u64 head )
+    {
+      return reinterpret_cast<Slot*>( head & PointerMask );
+    }
+
+    static inline u64 _tag( Slot* slot, const u64 previousHead )
     {
-      for ( int i = 0; i < _size; ++i ) {
-        delete _objects[i];
-        _objects[i] = nullptr;
+      const u64 address = reinterpret_cast<u64>( slot );
+      assert( 0 == ( address & ~PointerMask ) );
+      return ( ( ( previousHead >> TagShift ) + 1 ) << TagShift ) | address;
+    }
+
+    Slab& _addSlab( const size_t count )
+    {
+      assert( count <= MaxSlabObjects );
+      if ( _slabs.size() >= MaxSlabs ) {
+        throw MemoryException( "Pool " + _name + " has reached its maximum slab count" );
       }
 
-      delete[] _objects;
+      const u32 slabIndex = static_cast<u32>( _slabs.size() ) << SlabShift;
+
+      Slab slab;
+      slab.size = count;
+      slab.bytes = sizeof( Slot ) * count;
+      slab.hugePages = _growthPolicy.hugePages;
+      slab.slots = static_cast<Slot*>( SlabAllocator::Allocate( slab.bytes, alignof( Slot ), slab.hugePages ) );
+
+      // Only the slot headers are initialized, objects are constructed lazily.
+      for ( size_t i = 0; i < count; ++i ) {
+        Slot* slot = new ( slab.slots + i ) Slot();
+        slot->index = slabIndex | static_cast<u32>( i );
+        slot->next() = ( i + 1 < count ) ? slab.slots + i + 1 : nullptr;
+      }
+
+      _size += count;
+      _reservedBytes += slab.bytes;
+      _slabs.push_back( std::move( slab ) );
+      return _slabs.back();
+    }
+
+    ///
+    /// \brief Adds count slots to the pool, split across as many slabs as
+    ///     handle indices require, and makes them available to create().
+    void _reserve( size_t count )
+    {
+      while ( count ) {
+        Slab& slab = _addSlab( std::min( count, MaxSlabObjects ) );
+        _pushFree( slab.slots, slab.slots + slab.size - 1 );
+        count -= slab.size;
+      }
+    }
+
+    ///
+    /// \brief Pushes a linked chain of free slots onto the front of the free list.
+    void _pushFree( Slot* first, Slot* last )
+    {
+      if ( PoolThreading::Concurrent == _threading ) {
+        u64 head = _head.load( std::memory_order_relaxed );
+        do {
+          last->next() = _untag( head );
+        } while ( !_head.compare_exchange_weak( head, _tag( first, head ),
+                                                std::memory_order_release,
+                                                std::memory_order_relaxed ) );
+        return;
+      }
+
+      last->next() = _next;
+      _next = first;
     }
 
-    inline T* create()
+    inline Slot* _popFree()
     {
-      assert( _next );
       if ( !_next ) {
+        _grow();
+      }
+
+      Slot* slot = _next;
+      _next = slot->next();
+      return slot;
+    }
+
+    Slot* _popFreeConcurrent()
+    {
+      u64 head = _head.load( std::memory_order_acquire );
+      while ( true ) {
+        Slot* slot = _untag( head );
+        if ( !slot ) {
+          std::lock_guard<std::mutex> lock( _growthMutex );
+          if ( !_untag( _head.load( std::memory_order_acquire ) ) ) {
+            _grow();
+          }
+          head = _head.load( std::memory_order_acquire );
+          continue;
+        }
+
+        // If another thread pops this slot first, the link read here may be
+        // stale or overwritten, but the tag guarantees the exchange fails.
+        Slot* next = slot->next();
+        if ( _head.compare_exchange_weak( head, _tag( next, head ),
+                                          std::memory_order_acquire,
+                                          std::memory_order_acquire ) ) {
+          return slot;
+        }
+      }
+    }
+
+    void _grow()
+    {
+      size_t count = 0;
+      switch ( _growthPolicy.mode ) {
+      default:
+      case PoolGrowthPolicy::Mode::Fixed:
+        break;
+
+      case PoolGrowthPolicy::Mode::Linear:
+        count = ( _growthPolicy.slabSize ) ? _growthPolicy.slabSize : _initialSize;
+        break;
+
+      case PoolGrowthPolicy::Mode::Doubling:
+        count = _size;
+        break;
+      }
+
+      if ( _growthPolicy.maxSize ) {
+        count = ( _size < _growthPolicy.maxSize ) ? std::min( count, _growthPolicy.maxSize - _size ) : 0;
+      }
+
+      if ( !count ) {
         throw MemoryException( "Pool " + _name + " has reached maximum capacity" );
-        // TODO: Resize...
       }
 
-      T* p = _next;
-      assert( false == p->inUse );
-      p->inUse = true;
-      _next = p->next;
+      LogWrite( Info, "Pool %s growing from %llu to %llu objects", _name.c_str(), TO_LLU( _size ), TO_LLU( _size + count ) );
+      _reserve( count );
+    }
+
+  public:
+
+    inline MemoryPool( const string& name,
+                       const size_t size,
+                       const PoolGrowthPolicy& growthPolicy = PoolGrowthPolicy(),
+                       const PoolThreading threading = PoolThreading::Single )
+      : _name( name )
+      , _initialSize( std::max<size_t>( size, 1 ) )
+      , _growthPolicy( growthPolicy )
+      , _threading( threading )
+    {
+      _reserve( _initialSize );
+    }
 
-      ++_activeObjectCount;
+    inline virtual ~MemoryPool() override
+    {
+      for ( auto& slab : _slabs ) {
+        for ( size_t i = 0; i < slab.size; ++i ) {
+          if ( slab.slots[i].active() ) {
+            slab.slots[i].object()->~T();
+          }
+        }
+        SlabAllocator::Free( slab.slots, slab.bytes, slab.hugePages );
+      }
+    }
+
+    ///
+    /// \brief Constructs an object in a free slot, forwarding any arguments
+    ///     to its constructor.
+    template<typename ... Args>
+    inline T* create( Args&& ... args )
+    {
+      const bool concurrent = ( PoolThreading::Concurrent == _threading );
+      Slot* slot = nullptr;
+      T* p = nullptr;
+      try {
+        slot = ( concurrent ) ? _popFreeConcurrent() : _popFree();
+        p = new ( slot->storage ) T( std::forward<Args>( args ) ... );
+      }
+      catch ( ... ) {
+        if ( slot ) {
+          _pushFree( slot, slot );
+        }
+        _count( _failureCount );
+        throw;
+      }
+
+      ++slot->generation;
+
+      _count( _allocationCount );
+      if ( concurrent ) {
+        _updateHighWaterMark( _concurrentActiveObjectCount.fetch_add( 1, std::memory_order_relaxed ) + 1 );
+      }
+      else {
+        _updateHighWaterMark( ++_activeObjectCount );
+      }
 
       return p;
     }
 
     inline void destroy( T* object )
     {
-      if ( !object->inUse ) {
+      Slot* slot = _slotOf( object );
+      if ( !slot->active() ) {
         //throw Exception( "Attempting to destroy object not in use" );
         LogWrite( Warning, "Attempted to destroy object not in use" );
         return;
       }
 
-      Alloc<T>* alloc = object;
-
-      // Destruct and re-construct the object in-place at its known address.
+      // Destruct the object, its storage now holds the free list link.
       object->~T();
-      new ( object ) T();
+      ++slot->generation;
 
-      assert( false == alloc->inUse );
+      // Put this slot at the front of the list.
+      _pushFree( slot, slot );
+      _count( _deallocationCount );
 
-      // Put this object at the front of the list.
-      alloc->next = _next;
-      _next = object;
-
-      --_activeObjectCount;
+      if ( PoolThreading::Concurrent == _threading ) {
+        _concurrentActiveObjectCount.fetch_sub( 1, std::memory_order_relaxed );
+      }
+      else {
+        --_activeObjectCount;
+      }
 
       // TODO: Pass double pointer or ref to assign object to null.
     }
 
+    ///
+    /// \brief Returns true if the object is currently constructed in this pool.
+    inline bool isActive( T* object ) const
+    {
+      return _slotOf( object )->active();
+    }
+
+    ///
+    /// \brief Returns a handle to an object created by this pool, or a null
+    ///     handle if the object is not in use.
+    inline Handle<T> getHandle( T* object ) const
+    {
+      const Slot* slot = _slotOf( object );
+      return ( slot->active() ) ? Handle<T>( slot->index, slot->generation ) : Handle<T>();
+    }
+
+    ///
+    /// \brief Returns the object referenced by the handle, or nullptr if it
+    ///     has been destroyed since the handle was taken.
+    /// \details Concurrent pools may not resolve handles while another thread
+    ///     is growing the pool.
+    inline T* resolve( const Handle<T>& handle )
+    {
+      const size_t slabIdx = handle.index >> SlabShift;
+      const size_t offset = handle.index & OffsetMask;
+      if ( slabIdx >= _slabs.size() || offset >= _slabs[slabIdx].size ) {
+        return nullptr;
+      }
+
+      Slot* slot = _slabs[slabIdx].slots + offset;
+      if ( slot->active() && slot->generation == handle.generation ) {
+        return slot->object();
+      }
+
+      return nullptr;
+    }
+
+    inline bool isValid( const Handle<T>& handle )
+    {
+      return !!( resolve( handle ) );
+    }
+
+    inline void destroy( const Handle<T>& handle )
+    {
+      T* object = resolve( handle );
+      if ( !object ) {
+        LogWrite( Warning, "Attempted to destroy object through a stale handle" );
+        return;
+      }
+
+      destroy( object );
+    }
+
+    ///
+    /// \brief Grows the pool to hold at least newSize objects by chaining a
+    ///     new slab. Existing objects are never moved, so shrinking is not
+    ///     supported.
     inline virtual void resize( const size_t newSize ) override
     {
-      //...
+      if ( newSize <= _size ) {
+        LogWrite( Warning, "Pool %s cannot shrink from %llu to %llu objects", _name.c_str(), TO_LLU( _size ), TO_LLU( newSize ) );
+        return;
+      }
+
+      if ( _growthPolicy.maxSize && newSize > _growthPolicy.maxSize ) {
+        throw MemoryException( "Pool " + _name + " cannot be resized beyond its maximum capacity" );
+      }
+
+      std::unique_lock<std::mutex> lock( _growthMutex, std::defer_lock );
+      if ( PoolThreading::Concurrent == _threading ) {
+        lock.lock();
+      }
+
+      _reserve( newSize - _size );
+    }
+
+    inline virtual void setGrowthPolicy( const PoolGrowthPolicy& policy ) override
+    {
+      _growthPolicy = policy;
     }
 
     inline virtual void destroyAll() override
     {
-      for ( int i = 0; i < _size; ++i ) {
-        if ( _objects[i]->inUse ) {
-          destroy( _objects[i] );
+      forEachActive( [this] ( T* object ) {
+        destroy( object );
+      } );
+    }
+
+    ///
+    /// \brief Calls func on every object in use, walking each slab linearly.
+    template<typename Func>
+    inline void forEachActive( Func&& func )
+    {
+      for ( auto& slab : _slabs ) {
+        Slot* const end = slab.slots + slab.size;
+        for ( Slot* slot = slab.slots; slot != end; ++slot ) {
+          if ( slot->active() ) {
+            func( slot->object() );
+          }
         }
       }
     }
 
-    inline T* getObjectAt( const size_t idx )
+    ///
+    /// \brief Returns the object at the specified slot index, or nullptr if
+    ///     that slot is not in use.
+    inline T* getObjectAt( size_t idx )
     {
       if ( idx >= _size ) {
         throw MemoryException( "Invalid index " + std::to_string( idx ) );
       }
 
-      return _objects[idx];
+      for ( auto& slab : _slabs ) {
+        if ( idx < slab.size ) {
+          Slot* slot = slab.slots + idx;
+          return ( slot->active() ) ? slot->object() : nullptr;
+        }
+        idx -= slab.size;
+      }
+
+      return nullptr;
     }
 
     //
@@ -175,6 +600,10 @@ namespace Lore {
 
     inline size_t getActiveObjectCount() const
     {
+      if ( PoolThreading::Concurrent == _threading ) {
+        return _concurrentActiveObjectCount.load( std::memory_order_relaxed );
+      }
+
       return _activeObjectCount;
     }
 
@@ -183,16 +612,52 @@ namespace Lore {
       return _size;
     }
 
+    inline size_t getSlabCount() const
+    {
+      return _slabs.size();
+    }
+
+    inline virtual PoolStats getStats() const override
+    {
+      PoolStats stats;
+      stats.name = _name;
+      stats.objectSize = sizeof( T );
+      stats.totalObjects = _size;
+      stats.activeObjects = getActiveObjectCount();
+      stats.highWaterMark = _highWaterMark.load( std::memory_order_relaxed );
+      stats.allocations = _allocationCount.load( std::memory_order_relaxed );
+      stats.deallocations = _deallocationCount.load( std::memory_order_relaxed );
+      stats.failures = _failureCount.load( std::memory_order_relaxed );
+      stats.slabs = _slabs.size();
+      stats.reservedBytes = _reservedBytes;
+      stats.liveBytes = stats.activeObjects * sizeof( T );
+      return stats;
+    }
+
+    inline const PoolGrowthPolicy& getGrowthPolicy() const
+    {
+      return _growthPolicy;
+    }
+
+    inline PoolThreading getThreading() const
+    {
+      return _threading;
+    }
+
     inline void printUsage()
     {
       printf( "Pool %s usage: \n\n", _name.c_str() );
-      for ( int i = 0; i < _size; ++i ) {
-        printf( "Object %d \t[%s]\n", i, ( _objects[i]->inUse ) ? "x" : " " );
+      for ( size_t i = 0; i < _size; ++i ) {
+        printf( "Object %zu \t[%s]\n", i, ( getObjectAt( i ) ) ? "x" : " " );
       }
     }
 
   };
 
+  // Bound by reference in std::min(), so C++14 needs a definition.
+  template<typename T>
+  constexpr const size_t MemoryPool<T>::MaxSlabObjects;
+
 }
 
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
@@ -0,0 +1,115 @@
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+// The MIT License (MIT)
+// This source file is part of LORE
+// ( Lightweight Object-oriented Rendering Engine )
+//
+// Copyright (c) 2017-2021 Jordan Sparks
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files ( the "Software" ), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+#include <LORE/Memory/SlabAllocator.h>
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+using namespace Lore;
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+#ifdef LORE_PLATFORM_POSIX
+
+#include <cstdlib>
+#include <sys/mman.h>
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+namespace LocalNS {
+
+  constexpr const size_t HugePageSize = 2 * 1024 * 1024;
+
+  static size_t HugePageRoundUp( const size_t bytes )
+  {
+    return ( bytes + HugePageSize - 1 ) & ~( HugePageSize - 1 );
+  }
+
+}
+using namespace LocalNS;
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+// Bound by reference in std::max(), so C++14 needs a definition.
+constexpr const size_t SlabAllocator::CacheLineSize;
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+void* SlabAllocator::Allocate( const size_t bytes,
+                               const size_t alignment,
+                               bool& hugePages )
+{
+  const size_t align = std::max( alignment, CacheLineSize );
+
+#if LORE_PLATFORM == LORE_LINUX
+  if ( hugePages ) {
+    // Anonymous mappings are page aligned, which covers any object alignment.
+    const size_t size = HugePageRoundUp( bytes );
+    void* block = mmap( nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0 );
+    if ( MAP_FAILED != block ) {
+      madvise( block, size, MADV_HUGEPAGE );
+      return block;
+    }
+
+    LogWrite( Warning, "Unable to map %llu bytes for huge page slab, using regular pages", TO_LLU( size ) );
+  }
+#endif
+
+  hugePages = false;
+
+  void* block = nullptr;
+  if ( 0 != posix_memalign( &block, align, bytes ) ) {
+    throw MemoryException( "Failed to allocate slab of " + std::to_string( bytes ) + " bytes" );
+  }
+
+  return block;
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+void SlabAllocator::Free( void* block,
+                          const size_t bytes,
+                          const bool hugePages )
+{
+  if ( !block ) {
+    return;
+  }
+
+#if LORE_PLATFORM == LORE_LINUX
+  if ( hugePages ) {
+    munmap( block, HugePageRoundUp( bytes ) );
+    return;
+  }
+#endif
+
+  free( block );
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+#endif
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
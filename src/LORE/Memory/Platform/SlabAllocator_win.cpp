@@ -0,0 +1,97 @@
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+// The MIT License (MIT)
+// This source file is part of LORE
+// ( Lightweight Object-oriented Rendering Engine )
+//
+// Copyright (c) 2017-2021 Jordan Sparks
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files ( the "Software" ), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+#include <LORE/Memory/SlabAllocator.h>
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+using namespace Lore;
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+#if LORE_PLATFORM == LORE_WINDOWS
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+// Bound by reference in std::max(), so C++14 needs a definition.
+constexpr const size_t SlabAllocator::CacheLineSize;
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+void* SlabAllocator::Allocate( const size_t bytes,
+                               const size_t alignment,
+                               bool& hugePages )
+{
+  const size_t align = std::max( alignment, CacheLineSize );
+
+  if ( hugePages ) {
+    // Large pages require SeLockMemoryPrivilege, fall back to regular pages
+    // when the process doesn't hold it.
+    const size_t largePage = GetLargePageMinimum();
+    if ( largePage ) {
+      const size_t size = ( bytes + largePage - 1 ) & ~( largePage - 1 );
+      void* block = VirtualAlloc( nullptr, size, MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, PAGE_READWRITE );
+      if ( block ) {
+        return block;
+      }
+    }
+
+    LogWrite( Warning, "Large pages unavailable (error %d), using regular pages", GetLastError() );
+  }
+
+  hugePages = false;
+
+  void* block = _aligned_malloc( bytes, align );
+  if ( !block ) {
+    throw MemoryException( "Failed to allocate slab of " + std::to_string( bytes ) + " bytes" );
+  }
+
+  return block;
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+void SlabAllocator::Free( void* block,
+                          const size_t bytes,
+                          const bool hugePages )
+{
+  if ( !block ) {
+    return;
+  }
+
+  if ( hugePages ) {
+    VirtualFree( block, 0, MEM_RELEASE );
+    return;
+  }
+
+  _aligned_free( block );
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+#endif
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
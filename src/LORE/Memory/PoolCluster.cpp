@@ -0,0 +1,97 @@
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+// The MIT License (MIT)
+// This source file is part of LORE
+// ( Lightweight Object-oriented Rendering Engine )
+//
+// Copyright (c) 2017-2021 Jordan Sparks
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files ( the "Software" ), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+#include "PoolCluster.h"
+
+#ifdef LORE_PLATFORM_POSIX
+#include <cxxabi.h>
+#endif
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+using namespace Lore;
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+namespace PoolClusterNS {
+
+  static std::mutex SlotMutex;
+  static std::unordered_map<std::type_index, size_t> Slots;
+
+}
+using namespace PoolClusterNS;
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+size_t PoolTypeRegistry::Acquire( const std::type_index& type )
+{
+  std::lock_guard<std::mutex> lock( SlotMutex );
+
+  auto lookup = Slots.find( type );
+  if ( Slots.end() != lookup ) {
+    return lookup->second;
+  }
+
+  const size_t slot = Slots.size();
+  Slots.emplace( type, slot );
+  return slot;
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+string PoolTypeRegistry::GetName( const std::type_index& type )
+{
+  string name = type.name();
+
+#ifdef LORE_PLATFORM_POSIX
+  int status = 0;
+  char* demangled = abi::__cxa_demangle( name.c_str(), nullptr, nullptr, &status );
+  if ( demangled ) {
+    if ( 0 == status ) {
+      name = demangled;
+    }
+    std::free( demangled );
+  }
+#else
+  // MSVC names are already readable, e.g., "class Lore::Node".
+  for ( const string prefix : { "class ", "struct " } ) {
+    if ( 0 == name.compare( 0, prefix.size(), prefix ) ) {
+      name.erase( 0, prefix.size() );
+      break;
+    }
+  }
+#endif
+
+  // Strip namespaces, pooled types are not templates.
+  const size_t scope = name.rfind( "::" );
+  if ( string::npos != scope ) {
+    name.erase( 0, scope + 2 );
+  }
+
+  return name;
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
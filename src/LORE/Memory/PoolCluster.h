@@ -31,7 +31,67 @@
 
 namespace Lore {
 
-  using PoolTable = std::unordered_map<std::type_index, std::unique_ptr<MemoryPoolBase>>;
+  using PoolTable = std::vector<std::unique_ptr<MemoryPoolBase>>;
+
+  ///
+  /// \class PoolTypeRegistry
+  /// \brief Assigns each pooled type a process-wide slot index, used by
+  ///     PoolCluster to index its flat pool table.
+  /// \details Lives in the LORE library so the render plugin and clients
+  ///     agree on the same index for a type.
+  class LORE_EXPORT PoolTypeRegistry final
+  {
+
+  public:
+
+    ///
+    /// \brief Returns the slot index for the type, assigning one on first use.
+    static size_t Acquire( const std::type_index& type );
+
+    ///
+    /// \brief Returns the unqualified, compiler independent name of the type
+    ///     (e.g., "Node" for Lore::Node). Used to name pools and to match
+    ///     entries in pool configuration files.
+    static string GetName( const std::type_index& type );
+
+  };
+
+  // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+  ///
+  /// \struct PoolConfig
+  /// \brief Overrides the settings a pool is registered with, keyed by the
+  ///     name of its interface type (see PoolTypeRegistry::GetName()).
+  struct PoolConfig
+  {
+
+    // Initial object count (0 keeps the size passed to registerPool()).
+    size_t size { 0 };
+
+    PoolGrowthPolicy growthPolicy {};
+    bool overrideGrowthPolicy { false };
+
+  };
+
+  // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+  ///
+  /// \struct PoolSlot
+  /// \brief Caches the slot index of type T, so pool lookups only pay for
+  ///     the type registry once per type.
+  template<typename T>
+  struct PoolSlot
+  {
+
+    static inline size_t Get()
+    {
+      static const size_t slot = PoolTypeRegistry::Acquire( std::type_index( typeid( T ) ) );
+      return slot;
+    }
+
+  };
+
+  // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
 
   ///
   /// \class PoolCluster
@@ -40,25 +100,17 @@ namespace Lore {
   {
 
     template<typename T>
-    MemoryPoolBase* _getPool()
+    inline MemoryPoolBase* _getPool()
     {
-      if ( _pools.empty() ) {
-        return nullptr;
-      }
-
-      auto t = std::type_index( typeid( T ) );
-      auto lookup = _pools.find( t );
-      if ( _pools.end() != lookup ) {
-        return lookup->second.get();
-      }
-
-      return nullptr;
+      const size_t slot = PoolSlot<T>::Get();
+      return ( slot < _pools.size() ) ? _pools[slot].get() : nullptr;
     }
 
     // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
 
     string _name {};
     PoolTable _pools {};
+    std::unordered_map<string, PoolConfig> _configs {};
 
   public:
 
@@ -72,16 +124,53 @@ namespace Lore {
     //
     // Pool management.
 
+    ///
+    /// \brief Registers a pool for type T. Pools registered with
+    ///     PoolThreading::Concurrent allow create<T>() and destroy<T>() to be
+    ///     called from any thread.
+    /// \details The pool is named after T rather than TDerived, so its stats
+    ///     match the name its configuration is looked up by.
     template<typename T, typename TDerived = T>
-    void registerPool( const size_t size )
+    void registerPool( const size_t size,
+                       const PoolGrowthPolicy& growthPolicy = PoolGrowthPolicy(),
+                       const PoolThreading threading = PoolThreading::Single )
     {
-      auto t = std::type_index( typeid( T ) );
-      auto lookup = _pools.find( t );
-      if ( _pools.end() == lookup ) {
-        _pools[t] = std::make_unique<MemoryPool<TDerived>>( typeid( TDerived ).name(), size );
+      const size_t slot = PoolSlot<T>::Get();
+      if ( slot >= _pools.size() ) {
+        _pools.resize( slot + 1 );
+      }
+
+      if ( !_pools[slot] ) {
+        const string name = PoolTypeRegistry::GetName( typeid( T ) );
+        size_t poolSize = size;
+        PoolGrowthPolicy poolGrowthPolicy = growthPolicy;
+
+        auto lookup = _configs.find( name );
+        if ( _configs.end() != lookup ) {
+          const PoolConfig& config = lookup->second;
+          if ( config.size ) {
+            poolSize = config.size;
+          }
+          if ( config.overrideGrowthPolicy ) {
+            poolGrowthPolicy = config.growthPolicy;
+          }
+        }
+
+        _pools[slot] = std::make_unique<MemoryPool<TDerived>>( name,
+                                                               poolSize,
+                                                               poolGrowthPolicy,
+                                                               threading );
       }
     }
 
+    ///
+    /// \brief Overrides the settings of the pool for the named type when it is
+    ///     registered. Pools that are already registered are unaffected.
+    void setPoolConfig( const string& typeName, const PoolConfig& config )
+    {
+      _configs[typeName] = config;
+    }
+
     template<typename T>
     void resizePool( const size_t newSize )
     {
@@ -91,21 +180,92 @@ namespace Lore {
       }
     }
 
+    template<typename T>
+    void setPoolGrowthPolicy( const PoolGrowthPolicy& growthPolicy )
+    {
+      auto pool = _getPool<T>();
+      if ( pool ) {
+        pool->setGrowthPolicy( growthPolicy );
+      }
+    }
+
     template<typename T>
     void unregisterPool()
     {
-      auto t = std::type_index( typeid( T ) );
-      auto lookup = _pools.find( t );
-      if ( _pools.end() != lookup ) {
-        _pools.erase( lookup );
+      const size_t slot = PoolSlot<T>::Get();
+      if ( slot < _pools.size() ) {
+        _pools[slot].reset();
       }
     }
 
     void resetAllPools()
     {
-      for ( auto& pair : _pools ) {
-        pair.second->destroyAll();
+      for ( auto& pool : _pools ) {
+        if ( pool ) {
+          pool->destroyAll();
+        }
+      }
+    }
+
+    ///
+    /// \brief Calls func on every active object of type T, in memory order.
+    template<typename T, typename TDerived = T, typename Func>
+    void forEach( Func&& func )
+    {
+      auto pool = _getPool<T>();
+      if ( pool ) {
+        static_cast< MemoryPool<TDerived>* >( pool )->forEachActive( std::forward<Func>( func ) );
+      }
+    }
+
+    ///
+    /// \brief Returns true if the object is currently constructed in its pool.
+    template<typename T, typename TDerived = T>
+    bool isActive( T* object )
+    {
+      auto pool = _getPool<T>();
+      if ( pool ) {
+        return static_cast< MemoryPool<TDerived>* >( pool )->isActive( static_cast<TDerived*>( object ) );
       }
+
+      return false;
+    }
+
+    //
+    // Handles.
+
+    ///
+    /// \brief Returns a handle to an object of type T, or a null handle if the
+    ///     object is not in use.
+    template<typename T, typename TDerived = T>
+    Handle<T> getHandle( T* object )
+    {
+      auto pool = _getPool<T>();
+      if ( pool ) {
+        return static_cast< MemoryPool<TDerived>* >( pool )->getHandle( static_cast<TDerived*>( object ) );
+      }
+
+      return Handle<T>();
+    }
+
+    ///
+    /// \brief Returns the object referenced by the handle, or nullptr if the
+    ///     object has been destroyed or its slot reused.
+    template<typename T, typename TDerived = T>
+    TDerived* resolve( const Handle<T>& handle )
+    {
+      auto pool = _getPool<T>();
+      if ( pool ) {
+        return static_cast< MemoryPool<TDerived>* >( pool )->resolve( Handle<TDerived>( handle.index, handle.generation ) );
+      }
+
+      return nullptr;
+    }
+
+    template<typename T, typename TDerived = T>
+    bool isValid( const Handle<T>& handle )
+    {
+      return !!( resolve<T, TDerived>( handle ) );
     }
 
     template<typename T>
@@ -114,16 +274,60 @@ namespace Lore {
       return _getPool<T>();
     }
 
+    //
+    // Telemetry.
+
+    template<typename T>
+    PoolStats getPoolStats()
+    {
+      auto pool = _getPool<T>();
+      return ( pool ) ? pool->getStats() : PoolStats();
+    }
+
+    std::vector<PoolStats> getAllPoolStats() const
+    {
+      std::vector<PoolStats> stats;
+      stats.reserve( _pools.size() );
+      for ( const auto& pool : _pools ) {
+        if ( pool ) {
+          stats.push_back( pool->getStats() );
+        }
+      }
+
+      return stats;
+    }
+
+    ///
+    /// \brief Writes the stats of every pool to the log.
+    void logPoolStats() const
+    {
+      LogWrite( Info, "Pool cluster %s usage:", _name.c_str() );
+      for ( const auto& stats : getAllPoolStats() ) {
+        LogWrite( Info, "  %s: %llu/%llu objects active (high-water %llu), %llu allocations, %llu deallocations, "
+                  "%llu failures, %llu slabs, %llu/%llu bytes live/reserved",
+                  stats.name.c_str(),
+                  TO_LLU( stats.activeObjects ),
+                  TO_LLU( stats.totalObjects ),
+                  TO_LLU( stats.highWaterMark ),
+                  TO_LLU( stats.allocations ),
+                  TO_LLU( stats.deallocations ),
+                  TO_LLU( stats.failures ),
+                  TO_LLU( stats.slabs ),
+                  TO_LLU( stats.liveBytes ),
+                  TO_LLU( stats.reservedBytes ) );
+      }
+    }
+
     //
     // Object management.
 
-    template<typename T, typename TDerived = T>
-    TDerived* create()
+    template<typename T, typename TDerived = T, typename ... Args>
+    TDerived* create( Args&& ... args )
     {
       auto pool = _getPool<T>();
       if ( pool ) {
           MemoryPool<TDerived>* TPool = static_cast< MemoryPool<TDerived>* >( pool );
-          return TPool->create();
+          return TPool->create( std::forward<Args>( args ) ... );
       }
 
       throw Lore::Exception( "PoolCluster::create<T>: Pool of type " +
@@ -145,6 +349,19 @@ namespace Lore {
       }
     }
 
+    template<typename T, typename TDerived = T>
+    void destroy( const Handle<T>& handle )
+    {
+      TDerived* object = resolve<T, TDerived>( handle );
+      if ( object ) {
+        destroy<T, TDerived>( object );
+      }
+      else {
+        LogWrite( Warning, "PoolCluster::destroy<T>: Stale handle for pool of type %s",
+                  typeid( TDerived ).name() );
+      }
+    }
+
   };
 
 }
@@ -0,0 +1,62 @@
+#pragma once
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+// The MIT License (MIT)
+// This source file is part of LORE
+// ( Lightweight Object-oriented Rendering Engine )
+//
+// Copyright (c) 2017-2021 Jordan Sparks
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files ( the "Software" ), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+namespace Lore {
+
+  ///
+  /// \class SlabAllocator
+  /// \brief Purely static class which provides the raw, aligned blocks of
+  ///     memory that MemoryPool slabs are carved from.
+  class LORE_EXPORT SlabAllocator final
+  {
+
+  public:
+
+    static constexpr const size_t CacheLineSize = 64;
+
+    ///
+    /// \brief Allocates a block of at least the specified size, aligned to
+    ///     at least a cache line. If hugePages is true, the block is backed by
+    ///     huge pages where the platform supports it.
+    /// \details hugePages is cleared when the block falls back to regular
+    ///     pages, so it records how the block must be freed.
+    static void* Allocate( const size_t bytes,
+                           const size_t alignment,
+                           bool& hugePages );
+
+    ///
+    /// \brief Frees a block returned by Allocate(). The size and huge page
+    ///     flag must match those left by the original allocation.
+    static void Free( void* block,
+                      const size_t bytes,
+                      const bool hugePages );
+
+  };
+
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
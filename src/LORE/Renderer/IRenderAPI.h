@@ -74,6 +74,16 @@ namespace Lore {
       Always
     };
 
+    ///
+    /// \struct StateStats
+    /// \brief State changes passed to and filtered from the driver since
+    ///     the start of the current frame.
+    struct StateStats
+    {
+      uint32_t issued { 0 };
+      uint32_t skipped { 0 };
+    };
+
     // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
 
     virtual ~IRenderAPI() = default;
@@ -119,6 +129,15 @@ namespace Lore {
     virtual void setBlendingEnabled( const bool enabled ) = 0;
     virtual void setBlendingFunc( const BlendFactor& src, const BlendFactor& dst ) = 0;
 
+    //
+    // Statistics.
+
+    ///
+    /// \brief Zeroes the state change counters, called at the start of each frame.
+    virtual void resetStateStats() = 0;
+
+    virtual const StateStats& getStateStats() const = 0;
+
     //
     // Debugging.
 #ifdef _DEBUG
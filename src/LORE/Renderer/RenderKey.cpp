@@ -0,0 +1,219 @@
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+// The MIT License (MIT)
+// This source file is part of LORE
+// ( Lightweight Object-oriented Rendering Engine )
+//
+// Copyright (c) 2017-2021 Jordan Sparks
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files ( the "Software" ), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+#include "RenderKey.h"
+
+#include <cstring>
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+using namespace Lore;
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+namespace LocalNS {
+
+  // Below this many entries an insertion sort beats the radix passes.
+  static constexpr const size_t RadixSortThreshold = 64;
+
+  static constexpr const uint32_t RadixBits = 8;
+  static constexpr const uint32_t RadixPasses = 64 / RadixBits;
+  static constexpr const uint32_t RadixSize = 1 << RadixBits;
+
+  ///
+  /// \brief Hashes a resource pointer down to the given number of bits.
+  static inline uint64_t Fold( const void* p, const uint32_t bits )
+  {
+    const uint64_t v = static_cast< uint64_t >( reinterpret_cast< uintptr_t >( p ) );
+    return ( v * 0x9E3779B97F4A7C15ull ) >> ( 64 - bits );
+  }
+
+  static void InsertionSort( DrawList::Entry* entries, const size_t count )
+  {
+    for ( size_t i = 1; i < count; ++i ) {
+      const DrawList::Entry entry = entries[i];
+      size_t j = i;
+      while ( j > 0 && entries[j - 1].key > entry.key ) {
+        entries[j] = entries[j - 1];
+        --j;
+      }
+      entries[j] = entry;
+    }
+  }
+
+  ///
+  /// \brief Stable LSD radix sort of entries by key. Passes over digits that
+  ///     are the same for every key are skipped, which is common since keys
+  ///     in a queue tend to share their high bits.
+  static void RadixSort( DrawList::Entry* entries,
+                         DrawList::Entry* scratch,
+                         const size_t count )
+  {
+    // Build the histogram for every digit in a single pass.
+    size_t counts[RadixPasses][RadixSize] = {};
+    for ( size_t i = 0; i < count; ++i ) {
+      uint64_t key = entries[i].key;
+      for ( uint32_t pass = 0; pass < RadixPasses; ++pass ) {
+        ++counts[pass][key & ( RadixSize - 1 )];
+        key >>= RadixBits;
+      }
+    }
+
+    DrawList::Entry* src = entries;
+    DrawList::Entry* dst = scratch;
+    for ( uint32_t pass = 0; pass < RadixPasses; ++pass ) {
+      size_t* histogram = counts[pass];
+      const uint32_t shift = pass * RadixBits;
+
+      if ( count == histogram[( src[0].key >> shift ) & ( RadixSize - 1 )] ) {
+        continue;
+      }
+
+      // Convert counts to starting offsets.
+      size_t offset = 0;
+      for ( uint32_t digit = 0; digit < RadixSize; ++digit ) {
+        const size_t n = histogram[digit];
+        histogram[digit] = offset;
+        offset += n;
+      }
+
+      for ( size_t i = 0; i < count; ++i ) {
+        const uint32_t digit = static_cast< uint32_t >( src[i].key >> shift ) & ( RadixSize - 1 );
+        dst[histogram[digit]++] = src[i];
+      }
+
+      std::swap( src, dst );
+    }
+
+    if ( src != entries ) {
+      std::copy( src, src + count, entries );
+    }
+  }
+
+}
+using namespace LocalNS;
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+uint64_t RenderKey::Opaque( const void* program,
+                            const void* material,
+                            const void* model,
+                            const real depth )
+{
+  return ( Fold( program, 15 ) << 48 ) |
+         ( Fold( material, 16 ) << 32 ) |
+         ( Fold( model, 12 ) << 20 ) |
+         ( QuantizeDepth( depth ) >> 12 );
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+uint64_t RenderKey::Translucent( const void* program,
+                                 const void* material,
+                                 const void* model,
+                                 const real depth )
+{
+  // Invert depth so the farthest draws come first.
+  const uint64_t inverted = ~QuantizeDepth( depth ) >> 8;
+
+  return TranslucentBit |
+         ( inverted << 39 ) |
+         ( Fold( program, 15 ) << 24 ) |
+         ( Fold( material, 16 ) << 8 ) |
+         Fold( model, 8 );
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+uint32_t RenderKey::QuantizeDepth( const real depth )
+{
+  const float value = static_cast< float >( depth );
+  uint32_t bits = 0;
+  std::memcpy( &bits, &value, sizeof( bits ) );
+
+  // Flip negative values entirely and set the sign bit of positive ones, so
+  // the IEEE bit patterns compare as unsigned integers in float order.
+  return ( bits & 0x80000000u ) ? ~bits : ( bits | 0x80000000u );
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+uint32_t DrawList::add( const uint64_t key,
+                        const PrefabPtr prefab,
+                        const NodePtr node )
+{
+  const uint32_t index = static_cast< uint32_t >( _items.size() );
+  _entries.push_back( { key, index } );
+  _items.emplace_back( prefab, node );
+  _keys.push_back( key );
+  _visible.push_back( 1 );
+  _sorted = false;
+  return index;
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+void DrawList::sort()
+{
+  if ( !_sorted ) {
+    // Start over from insertion order, so equal keys keep it.
+    const size_t count = _items.size();
+    for ( size_t i = 0; i < count; ++i ) {
+      _entries[i] = { _keys[i], static_cast< uint32_t >( i ) };
+    }
+
+    if ( count <= RadixSortThreshold ) {
+      InsertionSort( _entries.data(), count );
+    }
+    else {
+      _scratch.resize( count );
+      RadixSort( _entries.data(), _scratch.data(), count );
+    }
+    _sorted = true;
+  }
+
+  // Translucent keys have the top bit set, so they all follow opaque keys.
+  auto it = std::partition_point( _entries.begin(), _entries.end(),
+                                  [] ( const Entry& entry ) {
+                                    return 0 == ( entry.key & RenderKey::TranslucentBit );
+                                  } );
+  _opaqueCount = static_cast< size_t >( it - _entries.begin() );
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+void DrawList::clear()
+{
+  _entries.clear();
+  _items.clear();
+  _keys.clear();
+  _visible.clear();
+  _opaqueCount = 0;
+  _sorted = true;
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
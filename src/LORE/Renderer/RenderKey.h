@@ -0,0 +1,192 @@
+#pragma once
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+// The MIT License (MIT)
+// This source file is part of LORE
+// ( Lightweight Object-oriented Rendering Engine )
+//
+// Copyright (c) 2017-2021 Jordan Sparks
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files ( the "Software" ), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+#include <vector>
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+namespace Lore {
+
+  ///
+  /// \struct RenderKey
+  /// \brief Packs the state a draw depends on into a 64-bit key, so sorting
+  ///     keys groups draws by program, material and model.
+  /// \details Layout, most significant bits first:
+  ///
+  ///     Opaque:      [63] 0 | [62-48] program | [47-32] material | [31-20] model | [19-0] depth
+  ///     Translucent: [63] 1 | [62-39] depth   | [38-24] program  | [23-8] material | [7-0] model
+  ///
+  ///     Opaque keys put depth last, so draws sharing state are ordered
+  ///     front-to-back. Translucent keys put (inverted) depth first, so they
+  ///     are ordered back-to-front regardless of state. Resource fields are
+  ///     hashed pointers: a collision only costs an extra state change, since
+  ///     renderers compare the actual resources when walking a DrawList.
+  struct LORE_EXPORT RenderKey
+  {
+
+    static constexpr const uint64_t TranslucentBit = uint64_t( 1 ) << 63;
+
+    ///
+    /// \brief Returns a key for an opaque draw. Smaller depths sort first.
+    static uint64_t Opaque( const void* program,
+                            const void* material,
+                            const void* model,
+                            const real depth );
+
+    ///
+    /// \brief Returns a key for a translucent draw. Larger depths sort first.
+    static uint64_t Translucent( const void* program,
+                                 const void* material,
+                                 const void* model,
+                                 const real depth );
+
+    ///
+    /// \brief Maps depth to an unsigned integer with the same ordering.
+    static uint32_t QuantizeDepth( const real depth );
+
+  };
+
+  // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+  ///
+  /// \class DrawList
+  /// \brief A flat list of prefab/node draws, each tagged with a RenderKey.
+  ///     After sort() the list is indexed in key order, with all opaque draws
+  ///     before translucent ones.
+  /// \details Only the 16-byte key entries are moved while sorting, which is
+  ///     done with an LSD radix sort. Lists are kept between frames: draws
+  ///     keep the index add() returned, and sort() only reorders once a key
+  ///     has changed.
+  class LORE_EXPORT DrawList final
+  {
+
+  public:
+
+    struct Entry
+    {
+      uint64_t key { 0 };
+      uint32_t index { 0 };
+    };
+
+    using Item = std::pair<PrefabPtr, NodePtr>;
+    using EntryList = std::vector<Entry>;
+    using ItemList = std::vector<Item>;
+
+  private:
+
+    EntryList _entries {};
+    EntryList _scratch {};
+    ItemList _items {};
+    std::vector<uint64_t> _keys {};
+    std::vector<uint8_t> _visible {};
+    size_t _opaqueCount { 0 };
+    bool _sorted { true };
+
+  public:
+
+    DrawList() = default;
+
+    ///
+    /// \brief Appends a visible draw and returns its index.
+    uint32_t add( const uint64_t key,
+                  const PrefabPtr prefab,
+                  const NodePtr node );
+
+    inline void setKey( const uint32_t index, const uint64_t key )
+    {
+      if ( _keys[index] != key ) {
+        _keys[index] = key;
+        _sorted = false;
+      }
+    }
+
+    inline void setVisible( const uint32_t index, const bool visible )
+    {
+      _visible[index] = visible;
+    }
+
+    ///
+    /// \brief Orders the list by key. Draws with equal keys keep the order
+    ///     they were added in.
+    void sort();
+
+    void clear();
+
+    //
+    // Getters by index returned from add().
+
+    inline const Item& getItem( const uint32_t index ) const
+    {
+      return _items[index];
+    }
+
+    inline bool isItemVisible( const uint32_t index ) const
+    {
+      return !!( _visible[index] );
+    }
+
+    //
+    // Getters in key order (only valid after sort()).
+
+    inline const Item& operator [] ( const size_t i ) const
+    {
+      return _items[_entries[i].index];
+    }
+
+    inline uint64_t getKey( const size_t i ) const
+    {
+      return _entries[i].key;
+    }
+
+    inline bool isVisible( const size_t i ) const
+    {
+      return !!( _visible[_entries[i].index] );
+    }
+
+    inline size_t size() const
+    {
+      return _entries.size();
+    }
+
+    inline bool empty() const
+    {
+      return _entries.empty();
+    }
+
+    ///
+    /// \brief Returns the number of opaque draws, which are at the front of
+    ///     the list. Translucent draws follow.
+    inline size_t getOpaqueCount() const
+    {
+      return _opaqueCount;
+    }
+
+  };
+
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
@@ -0,0 +1,125 @@
+#pragma once
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+// The MIT License (MIT)
+// This source file is part of LORE
+// ( Lightweight Object-oriented Rendering Engine )
+//
+// Copyright (c) 2017-2021 Jordan Sparks
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files ( the "Software" ), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+#include <LORE/Renderer/RenderKey.h>
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+namespace Lore {
+
+  constexpr size_t DefaultRenderQueueCount = 100;
+
+  // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+  ///
+  /// \struct RenderQueue
+  /// \brief Holds a list of Renderables for rendering. RenderQueues are owned
+  ///     by a scene's RenderRegistry and handled by the Renderer implementation.
+  /// \details Queues are kept between frames and only rebuilt when something
+  ///     is attached, detached or changes queue. Renderers refresh the cached
+  ///     keys, visibility bits and transforms of whatever moved.
+  struct RenderQueue
+  {
+
+    struct BoxData
+    {
+      BoxPtr box { nullptr };
+      glm::mat4 model { 1.f };
+    };
+
+    struct TextboxData
+    {
+      TextboxPtr textbox { nullptr };
+      glm::mat4 model { 1.f };
+    };
+
+    struct LightData
+    {
+      std::vector<DirectionalLightPtr> directionalLights;
+      std::vector<std::pair<PointLightPtr, glm::vec3>> pointLights;
+    };
+
+    using NodeList = std::vector<NodePtr>;
+
+    ///
+    /// \brief Every node drawing an opaque instanced prefab, with a packed
+    ///     copy of the visible nodes' matrices.
+    struct InstancedSolid
+    {
+      PrefabPtr prefab { nullptr };
+      NodeList nodes {};
+      std::vector<uint8_t> visible {};
+
+      std::vector<glm::mat4> visibleMatrices {};
+      // Set when a node moved or changed visibility since the last repack.
+      bool stale { true };
+    };
+
+    // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+    using InstancedSolidList = std::vector<InstancedSolid>;
+    using BoxList = std::vector<BoxData>;
+    using TextboxList = std::vector<TextboxData>;
+
+    // Lore supports 100 render queues (but not really used currently), rendered in order from 0-99.
+    static const uint32_t Skybox = 0;
+    static const uint32_t General = 50;
+    static const uint32_t Foreground = 99;
+
+    // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+    void clear()
+    {
+      draws.clear();
+      instancedSolids.clear();
+      boxes.clear();
+      textboxes.clear();
+      lights.directionalLights.clear();
+      lights.pointLights.clear();
+    }
+
+    // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+    // Non-instanced solids and all transparents, ordered by RenderKey.
+    DrawList draws {};
+    InstancedSolidList instancedSolids {};
+    BoxList boxes {};
+    TextboxList textboxes {};
+    LightData lights {};
+
+  };
+
+  // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+  using RenderQueueList = std::vector<RenderQueue>;
+
+  // Active queues in render order, the list keeps its capacity between rebuilds.
+  using ActiveRenderQueueList = std::vector<std::pair<uint, RenderQueue*>>;
+
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
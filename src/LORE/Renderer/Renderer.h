@@ -25,6 +25,7 @@
 // THE SOFTWARE.
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
 
+#include <LORE/Renderer/RenderQueue.h>
 #include <LORE/Window/RenderView.h>
 
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
@@ -33,73 +34,17 @@ namespace Lore {
 
   class IRenderAPI;
 
-  constexpr size_t DefaultRenderQueueCount = 100;
-
   // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
 
   ///
-  /// \struct RenderQueue
-  /// \brief Holds a list of Renderables for rendering. RenderQueues are organized
-  ///     and handled by the IRenderer implementation.
-  struct RenderQueue
+  /// \struct CullingStats
+  /// \brief Visibility test counts for the most recent present() call.
+  /// \details Draws are only retested when they or the view moved, so a
+  ///     static scene seen from a still camera tests nothing.
+  struct CullingStats
   {
-
-    void clear()
-    {
-      solids.clear();
-      instancedSolids.clear();
-      transparents.clear();
-      boxes.clear();
-      textboxes.clear();
-      lights.directionalLights.clear();
-      lights.pointLights.clear();
-    }
-
-    // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
-
-    struct BoxData
-    {
-      BoxPtr box { nullptr };
-      glm::mat4 model { 1.f };
-    };
-
-    struct TextboxData
-    {
-      TextboxPtr textbox { nullptr };
-      glm::mat4 model { 1.f };
-    };
-
-    struct LightData
-    {
-      std::vector<DirectionalLightPtr> directionalLights;
-      std::vector<std::pair<PointLightPtr, glm::vec3>> pointLights;
-      
-    };
-
-    // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
-
-    using NodeList = std::vector<NodePtr>;
-    using PrefabNodeMap = std::map<PrefabPtr, NodeList>;
-    using InstancedPrefabSet = std::unordered_set<PrefabPtr>;
-    using PrefabNodePair = std::pair<PrefabPtr, NodePtr>;
-    using TransparentsMap = std::multimap<real, PrefabNodePair>;
-    using BoxList = std::vector<BoxData>;
-    using TextboxList = std::vector<TextboxData>;
-
-    // Lore supports 100 render queues (but not really used currently), rendered in order from 0-99.
-    static const uint32_t Skybox = 0;
-    static const uint32_t General = 50;
-    static const uint32_t Foreground = 99;
-
-    // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
-
-    PrefabNodeMap solids {};
-    InstancedPrefabSet instancedSolids {};
-    TransparentsMap transparents {};
-    BoxList boxes {};
-    TextboxList textboxes {};
-    LightData lights {};
-
+    uint32_t tested { 0 };
+    uint32_t visible { 0 };
   };
 
   // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
@@ -114,40 +59,28 @@ namespace Lore {
 
   protected:
 
-    virtual void _clearRenderQueues() = 0;
-
-    // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
-
     IRenderAPI* _api { nullptr };
 
+    CullingStats _cullingStats {};
+
   public:
 
     Renderer() = default;
     virtual ~Renderer() = default;
 
     ///
-    /// \brief Registers a Renderable object for rendering. This should be
-    ///     called when a Renderable is attached to a Node.
-    virtual void addRenderData( Lore::PrefabPtr e,
-                                Lore::NodePtr node ) = 0;
-
-    virtual void addBox( Lore::BoxPtr box,
-                         const glm::mat4& transform ) = 0;
-
-    virtual void addTextbox( Lore::TextboxPtr textbox,
-                             const glm::mat4& transform ) = 0;
-
-    virtual void addLight( Lore::LightPtr light,
-                           const Lore::NodePtr node ) = 0;
-
-    ///
-    /// \brief Uses internal Renderable lists to create a frame buffer using
-    ///     the provided RenderView.
+    /// \brief Renders the RenderView's scene, from the render queues kept by
+    ///     its RenderRegistry, to a frame buffer.
     virtual void present( const RenderView& rv,
                           const WindowPtr window ) = 0;
 
     void setRenderAPI( IRenderAPI* api );
 
+    inline const CullingStats& getCullingStats() const
+    {
+      return _cullingStats;
+    }
+
   };
 
   // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
@@ -51,113 +51,13 @@ using namespace Lore;
 
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
 
-Forward2DRenderer::Forward2DRenderer()
-{
-  // Initialize all available queues.
-  _queues.resize( DefaultRenderQueueCount );
-}
-
-// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
-
-void Forward2DRenderer::addRenderData( PrefabPtr prefab,
-                                     NodePtr node )
-{
-  // TODO: Consider a way of optimizing this by skipping processing data here
-  // and directly storing references to nodes in lists in the renderer.
-  const uint queueId = prefab->getRenderQueue();
-  const bool blended = prefab->getMaterial()->blendingMode.enabled;
-
-  // TODO: Fix two lookups here.
-  // Add this queue to the active queue list if not already there.
-  activateQueue( queueId, _queues[queueId] );
-
-  //
-  // Add render data for this prefab at the node's position to the queue.
-
-  RenderQueue& queue = _queues.at( queueId );
-
-  if ( blended ) {
-    RenderQueue::PrefabNodePair pair { prefab, node };
-    queue.transparents.insert( { node->getDepth(), pair } );
-  }
-  else {
-    if ( prefab->isInstanced() ) {
-      RenderQueue::InstancedPrefabSet& set = queue.instancedSolids;
-      // Only add instanced prefabs that haven't been processed yet.
-      if ( set.find( prefab ) == set.end() ) {
-        set.insert( prefab );
-      }
-    }
-    else {
-      RenderQueue::NodeList& nodes = queue.solids[prefab];
-      nodes.push_back( node );
-    }
-  }
-}
-
-// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
-
-void Forward2DRenderer::addBox( BoxPtr box,
-                              const glm::mat4& transform )
-{
-  const uint queueId = RenderQueue::General;
-
-  activateQueue( queueId, _queues[queueId] );
-
-  RenderQueue& queue = _queues.at( queueId );
-  RenderQueue::BoxData data;
-  data.box = box;
-  data.model = transform;
-
-  queue.boxes.push_back( data );
-}
-
-// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
-
-void Forward2DRenderer::addTextbox( TextboxPtr textbox,
-                                  const glm::mat4& transform )
-{
-  const uint queueId = textbox->getRenderQueue();
-
-  activateQueue( queueId, _queues[queueId] );
-  RenderQueue& queue = _queues.at( queueId );
-
-  RenderQueue::TextboxData data;
-  data.textbox = textbox;
-  data.model = transform;
-
-  queue.textboxes.push_back( data );
-}
-
-// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
-
-void Forward2DRenderer::addLight( LightPtr light, const NodePtr node )
-{
-  const uint queueId = RenderQueue::General;
-
-  activateQueue( queueId, _queues[queueId] );
-  RenderQueue& queue = _queues.at( queueId );
-
-  switch ( light->getType() ) {
-  default:
-    break;
-
-  case Light::Type::Directional:
-    queue.lights.directionalLights.push_back( static_cast< DirectionalLightPtr >( light ) );
-    break;
-
-  case Light::Type::Point:
-    queue.lights.pointLights.emplace_back( static_cast< PointLightPtr >( light ), node->getWorldPosition() );
-    break;
-  }
-}
-
-// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
-
 void Forward2DRenderer::present( const RenderView& rv, const WindowPtr window )
 {
-  // Build render queues for this RenderView.
+  // Bring the scene's render queues up to date. Keys only depend on node
+  // depth, so draws are only rekeyed when they move, whatever the camera does.
   rv.scene->updateSceneGraph();
+  RenderRegistry& registry = rv.scene->getRenderRegistry();
+  updateDraws( registry, registry.setView( this, glm::mat4( 1.f ) ) );
 
   const real aspectRatio = (rv.renderTarget) ? rv.renderTarget->getAspectRatio() : window->getAspectRatio();
   rv.camera->updateTracking();
@@ -197,8 +97,9 @@ void Forward2DRenderer::present( const RenderView& rv, const WindowPtr window )
   renderSkybox( rv, aspectRatio, projection );
 
   // Iterate through all active render queues and render each object.
-  for ( const auto& activeQueue : _activeQueues ) {
-    RenderQueue& queue = activeQueue.second;
+  for ( const auto& activeQueue : registry.getActiveQueues() ) {
+    RenderQueue& queue = *activeQueue.second;
+    queue.draws.sort();
 
     // Render solids.
     renderSolids( rv, queue, viewProjection );
@@ -210,8 +111,8 @@ void Forward2DRenderer::present( const RenderView& rv, const WindowPtr window )
     renderBoxes( queue, viewProjection );
   }
 
-  // AABBs.
-  /*auto renderAABBs = Config::GetValue( "RenderAABBs" );
+  // AABBs. Their boxes are only created once this is first enabled.
+  auto renderAABBs = Config::GetValue( "RenderAABBs" );
   if ( GET_VARIANT<bool>( renderAABBs ) ) {
     RenderQueue tmpQueue;
 
@@ -221,55 +122,75 @@ void Forward2DRenderer::present( const RenderView& rv, const WindowPtr window )
         RenderQueue::BoxData data;
         data.box = aabb->getBox();
         data.model = Math::CreateTransformationMatrix( node->getWorldPosition(), glm::quat(), aabb->getDimensions() * 5.f );
-        data.model[3][2] = Node::Depth::Min;
+        data.model[3][2] = Depth::Min;
 
         tmpQueue.boxes.push_back( data );
       }
 
-      Node::ChildNodeIterator it = node->getChildNodeIterator();
+      ChildNodeIterator it = node->getChildNodeIterator();
       while ( it.hasMore() ) {
         AddAABB( it.getNext() );
       }
     };
 
     auto root = rv.scene->getRootNode();
-    Node::ChildNodeIterator it = root->getChildNodeIterator();
+    ChildNodeIterator it = root->getChildNodeIterator();
     while ( it.hasMore() ) {
       AddAABB( it.getNext() );
     }
     renderBoxes( tmpQueue, viewProjection );
-  }*/
+  }
 
   if ( rv.renderTarget ) {
     rv.renderTarget->flush();
     // Re-bind default frame buffer if custom render target was specified.
     _api->bindDefaultFramebuffer();
   }
-
-  _clearRenderQueues();
 }
 
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
 
-void Forward2DRenderer::_clearRenderQueues()
+void Forward2DRenderer::updateDraws( RenderRegistry& registry, const bool full )
 {
-  // Remove all data from each queue.
-  for ( auto& queue : _queues ) {
-    queue.clear();
+  if ( full ) {
+    for ( const auto& activeQueue : registry.getActiveQueues() ) {
+      DrawList& draws = activeQueue.second->draws;
+      for ( size_t i = 0; i < draws.size(); ++i ) {
+        updateDraw( draws, static_cast< uint32_t >( i ) );
+      }
+    }
+    return;
   }
 
-  // Erase all queues from the active queue list.
-  _activeQueues.clear();
+  // Instanced solids are drawn whole, their matrices are already current.
+  for ( const auto i : registry.getMoved() ) {
+    const RenderRegistry::Entry& entry = registry[i];
+    if ( RenderRegistry::NoInstance == entry.instance ) {
+      updateDraw( registry.getQueue( entry.queue ).draws, entry.slot );
+    }
+  }
 }
 
-// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
 
-void Forward2DRenderer::activateQueue( const uint id, RenderQueue& rq )
+void Forward2DRenderer::updateDraw( DrawList& draws, const uint32_t index )
 {
-  const auto lookup = _activeQueues.find( id );
-  if ( _activeQueues.end() == lookup ) {
-    _activeQueues.insert( { id, rq } );
+  const PrefabPtr prefab = draws.getItem( index ).first;
+  const NodePtr node = draws.getItem( index ).second;
+  const MaterialPtr material = prefab->getMaterial();
+
+  // Nothing is culled, but another renderer may have culled this draw.
+  draws.setVisible( index, true );
+
+  if ( material->blendingMode.enabled ) {
+    // Transparents are drawn in order of increasing depth, the key puts
+    // larger values first.
+    draws.setKey( index, RenderKey::Translucent( material->program, material, prefab->getModel(), -node->getDepth() ) );
+  }
+  else {
+    // Smaller depths are nearer the camera, so solids sort front-to-back.
+    draws.setKey( index, RenderKey::Opaque( material->program, material, prefab->getModel(), node->getDepth() ) );
   }
 }
 
@@ -282,7 +203,7 @@ void Forward2DRenderer::renderSkybox( const RenderView& rv,
   SkyboxPtr skybox = rv.scene->getSkybox();
   const SkyboxLayerMap& layers = skybox->getLayerMap();
 
-  ModelPtr model = StockResource::GetModel( "Skybox2D" );
+  ModelPtr model = StockResource::GetModel( "Skybox2D"_sid );
 
   const glm::vec3 camPos = rv.camera->getPosition();
 
@@ -348,7 +269,8 @@ void Forward2DRenderer::renderSolids( const RenderView& rv,
                                       const glm::mat4& viewProjection ) const
 {
   // Render instanced solids.
-  for ( const auto& prefab : queue.instancedSolids ) {
+  for ( const auto& solid : queue.instancedSolids ) {
+    const PrefabPtr prefab = solid.prefab;
     MaterialPtr material = prefab->getMaterial();
     ModelPtr model = prefab->getInstancedModel();
     GPUProgramPtr program = material->program;
@@ -364,25 +286,35 @@ void Forward2DRenderer::renderSolids( const RenderView& rv,
     model->draw( program, prefab->getInstanceCount() );
   }
 
-  // Render non-instanced solids.
-  for ( auto& pair : queue.solids ) {
-    const PrefabPtr prefab = pair.first;
-    const RenderQueue::NodeList& nodes = pair.second;
+  // Render non-instanced solids. Draws are sorted by program, material then
+  // model, so state is only changed between groups.
+  GPUProgramPtr activeProgram = nullptr;
+  MaterialPtr activeMaterial = nullptr;
+  PrefabPtr activePrefab = nullptr;
+
+  for ( size_t i = 0; i < queue.draws.getOpaqueCount(); ++i ) {
+    const PrefabPtr prefab = queue.draws[i].first;
+    const NodePtr node = queue.draws[i].second;
 
     const MaterialPtr material = prefab->getMaterial();
-    const ModelPtr model = prefab->getModel();
     const GPUProgramPtr program = material->program;
 
-    _api->setCullingMode( prefab->cullingMode );
-
-    program->use();
-    program->updateUniforms( rv, material, queue.lights );
-
-    // Render each node associated with this prefab.
-    for ( const auto& node : nodes ) {
-      program->updateNodeUniforms( material, node, viewProjection );
-      model->draw( program );
+    if ( program != activeProgram ) {
+      program->use();
+      activeProgram = program;
+      activeMaterial = nullptr;
+    }
+    if ( material != activeMaterial ) {
+      program->updateUniforms( rv, material, queue.lights );
+      activeMaterial = material;
     }
+    if ( prefab != activePrefab ) {
+      _api->setCullingMode( prefab->cullingMode );
+      activePrefab = prefab;
+    }
+
+    program->updateNodeUniforms( material, node, viewProjection );
+    prefab->getModel()->draw( program );
   }
 }
 
@@ -394,11 +326,15 @@ void Forward2DRenderer::renderTransparents( const RenderView& rv,
 {
   _api->setBlendingEnabled( true );
 
-  // Render in forward order, so the farthest back is rendered first.
+  GPUProgramPtr activeProgram = nullptr;
+  MaterialPtr activeMaterial = nullptr;
+  PrefabPtr activePrefab = nullptr;
+
+  // Render in sorted order, so the farthest back is rendered first.
   // (Depth values increase going farther back).
-  for (const auto& pair : queue.transparents) {
-    const PrefabPtr prefab = pair.second.first;
-    NodePtr node = pair.second.second;
+  for ( size_t i = queue.draws.getOpaqueCount(); i < queue.draws.size(); ++i ) {
+    const PrefabPtr prefab = queue.draws[i].first;
+    NodePtr node = queue.draws[i].second;
 
     const MaterialPtr material = prefab->getMaterial();
     GPUProgramPtr program = material->program;
@@ -412,22 +348,31 @@ void Forward2DRenderer::renderTransparents( const RenderView& rv,
         throw Lore::Exception( "Instanced prefab must have an instanced model" );
 
       case Mesh::Type::QuadInstanced:
-        program = StockResource::GetGPUProgram( "StandardInstanced2D" );
+        program = StockResource::GetGPUProgram( "StandardInstanced2D"_sid );
         break;
 
       case Mesh::Type::TexturedQuadInstanced:
-        program = StockResource::GetGPUProgram( "StandardTexturedInstanced2D" );
+        program = StockResource::GetGPUProgram( "StandardTexturedInstanced2D"_sid );
         break;
       }
     }
 
-    // Set blending mode using material settings.
-    _api->setBlendingFunc( material->blendingMode.srcFactor, material->blendingMode.dstFactor );
-    _api->setCullingMode( prefab->cullingMode );
-
-    program->use();
+    if ( program != activeProgram ) {
+      program->use();
+      activeProgram = program;
+      activeMaterial = nullptr;
+    }
+    if ( material != activeMaterial ) {
+      // Set blending mode using material settings.
+      _api->setBlendingFunc( material->blendingMode.srcFactor, material->blendingMode.dstFactor );
+      program->updateUniforms( rv, material, queue.lights );
+      activeMaterial = material;
+    }
+    if ( prefab != activePrefab ) {
+      _api->setCullingMode( prefab->cullingMode );
+      activePrefab = prefab;
+    }
 
-    program->updateUniforms( rv, material, queue.lights );
     program->updateNodeUniforms( material, node, viewProjection );
 
     // Draw the prefab.
@@ -445,8 +390,8 @@ void Forward2DRenderer::renderBoxes( const RenderQueue& queue,
   _api->setBlendingEnabled( true );
   _api->setBlendingFunc( BlendFactor::SrcAlpha, BlendFactor::OneMinusSrcAlpha );
 
-  GPUProgramPtr program = StockResource::GetGPUProgram( "StandardBox2D" );
-  ModelPtr model = StockResource::GetModel( "TexturedQuad" );
+  GPUProgramPtr program = StockResource::GetGPUProgram( "StandardBox2D"_sid );
+  ModelPtr model = StockResource::GetModel( "TexturedQuad"_sid );
 
   program->use();
 
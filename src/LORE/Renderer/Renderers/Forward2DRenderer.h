@@ -33,26 +33,18 @@
 
 namespace Lore {
 
-  using RenderQueueList = std::vector<RenderQueue>;
-  using ActiveRenderQueueList = std::map<uint, RenderQueue&>;
-
-  // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
-
   ///
   /// \class Forward2DRenderer
   /// \brief A basic 2D forward renderer.
   class Forward2DRenderer : public Lore::Renderer
   {
 
-    RenderQueueList _queues { };
-    ActiveRenderQueueList _activeQueues { };
-
-    // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
-
-    void _clearRenderQueues() override;
+    ///
+    /// \brief Refreshes the key of every draw in registry's queues if full,
+    ///     otherwise only those of draws that moved.
+    void updateDraws( RenderRegistry& registry, const bool full );
 
-    void activateQueue( const uint id,
-      RenderQueue& rq );
+    void updateDraw( DrawList& draws, const uint32_t index );
 
     void renderSkybox( const RenderView& rv,
       const real aspectRatio,
@@ -71,21 +63,9 @@ namespace Lore {
 
   public:
 
-    Forward2DRenderer();
+    Forward2DRenderer() = default;
     ~Forward2DRenderer() override = default;
 
-    void addRenderData( PrefabPtr e,
-                        NodePtr node ) override;
-
-    void addBox( BoxPtr box,
-                 const glm::mat4& transform ) override;
-
-    void addTextbox( TextboxPtr textbox,
-                     const glm::mat4& transform ) override;
-
-    void addLight( LightPtr light,
-                   const NodePtr node ) override;
-
     void present( const RenderView& rv,
                   const WindowPtr window ) override;
 
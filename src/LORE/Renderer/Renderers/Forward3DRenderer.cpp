@@ -51,109 +51,33 @@ using namespace Lore;
 
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
 
-Forward3DRenderer::Forward3DRenderer()
-{
-  // Initialize all available queues.
-  _queues.resize( DefaultRenderQueueCount );
-}
-
-// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
-
-// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
-
-void Forward3DRenderer::addRenderData( PrefabPtr prefab,
-                                       NodePtr node )
-{
-  // TODO: Consider a way of optimizing this by skipping processing data here
-  // and directly storing references to nodes in lists in the renderer.
-  const uint queueId = prefab->getRenderQueue();
-  const bool blended = prefab->getMaterial()->blendingMode.enabled;
-
-  // TODO: Fix two lookups here.
-  // Add this queue to the active queue list if not already there.
-  _activateQueue( queueId, _queues[queueId] );
-
-  //
-  // Add render data for this prefab at the node's position to the queue.
-
-  RenderQueue& queue = _queues.at( queueId );
-
-  if ( blended ) {
-    RenderQueue::PrefabNodePair pair { prefab, node };
-    queue.transparents.insert( { glm::length2( _camera->getPosition() - node->getPosition() ), pair } );
+namespace LocalNS {
+
+  static UniformNameTable ShadowMatrixNames( "shadowMatrices[", "]" );
+
+  ///
+  /// \brief Returns true if node's bounds may overlap frustum. Nodes without
+  ///     bounds are always considered visible.
+  static bool IsVisible( const Frustum& frustum,
+                         const NodePtr node )
+  {
+    const BoundingBox& bounds = node->getWorldBounds();
+    return bounds.isEmpty() || frustum.intersectsAABB( bounds );
   }
-  else {
-    if ( prefab->isInstanced() ) {
-      RenderQueue::InstancedPrefabSet& set = queue.instancedSolids;
-      // Only add instanced prefabs that haven't been processed yet.
-      if ( set.find( prefab ) == set.end() ) {
-        set.insert( prefab );
-      }
-    }
-    else {
-      RenderQueue::NodeList& nodes = queue.solids[prefab];
-      nodes.push_back( node );
-    }
-  }
-}
-
-// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
-
-void Forward3DRenderer::addBox( BoxPtr box,
-                                const glm::mat4& transform )
-{
-  const uint queueId = RenderQueue::General;
-
-  _activateQueue( queueId, _queues[queueId] );
-
-  RenderQueue& queue = _queues.at( queueId );
-  RenderQueue::BoxData data;
-  data.box = box;
-  data.model = transform;
-
-  queue.boxes.push_back( data );
-}
-
-// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
-
-void Forward3DRenderer::addTextbox( TextboxPtr textbox,
-                                    const glm::mat4& transform )
-{
-  const uint queueId = textbox->getRenderQueue();
-
-  _activateQueue( queueId, _queues[queueId] );
-  RenderQueue& queue = _queues.at( queueId );
-
-  RenderQueue::TextboxData data;
-  data.textbox = textbox;
-  data.model = transform;
-
-  queue.textboxes.push_back( data );
-}
 
-// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
-
-void Forward3DRenderer::addLight( LightPtr light,
-                                  const NodePtr node )
-{
-  const uint queueId = RenderQueue::General;
-
-  _activateQueue( queueId, _queues[queueId] );
-  RenderQueue& queue = _queues.at( queueId );
-
-  switch ( light->getType() ) {
-  default:
-    break;
-
-  case Light::Type::Directional:
-    queue.lights.directionalLights.push_back( static_cast< DirectionalLightPtr >( light ) );
-    break;
-
-  case Light::Type::Point:
-    queue.lights.pointLights.emplace_back( static_cast<PointLightPtr>( light ), node->getWorldPosition() );
-    break;
+  ///
+  /// \brief Returns true if node's bounds may be within range of a point
+  ///     light's shadow map.
+  static bool IsInRange( const glm::vec3& lightPos,
+                         const real range,
+                         const NodePtr node )
+  {
+    const BoundingBox& bounds = node->getWorldBounds();
+    return bounds.isEmpty() || BoundingSphere( lightPos, range ).intersects( bounds );
   }
+
 }
+using namespace LocalNS;
 
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
 
@@ -162,25 +86,37 @@ void Forward3DRenderer::present( const RenderView& rv,
 {
   _camera = rv.camera;
 
-  // Build render queues for this RenderView.
+  // Setup view-projection matrix. This is needed before draws are culled.
+  // TODO: Take viewport dimensions into account. Cache more things inside window.
+  const real aspectRatio = _getAspectRatio( rv );
+  const glm::mat4 projection = glm::perspective( glm::radians( 45.f ),
+                                                 aspectRatio,
+                                                 0.1f, 20000.f );
+
+  const glm::mat4 viewProjection = projection * rv.camera->getViewMatrix();
+  _frustum.update( viewProjection );
+  _cullingStats = {};
+
+  // Bring the scene's render queues up to date, then refresh the draws that
+  // moved since they were last culled, or all of them if the view changed.
   rv.scene->updateSceneGraph();
+  RenderRegistry& registry = rv.scene->getRenderRegistry();
+  const ActiveRenderQueueList& activeQueues = registry.getActiveQueues();
+  _updateDraws( registry, registry.setView( this, viewProjection ) );
 
-  // Add directional lights.
-  auto dirLightIt = rv.scene->getDirectionalLights().getConstIterator();
-  while ( dirLightIt.hasMore() ) {
-    auto dirLight = dirLightIt.getNext();
-    addLight( dirLight, nullptr );
+  // Order each queue's draws by state and depth, if any key changed.
+  for ( const auto& activeQueue : activeQueues ) {
+    activeQueue.second->draws.sort();
   }
 
   //
   // Render shadow maps first.
   
-  _renderShadowMaps( rv, _queues.at( RenderQueue::General ) );
+  _renderShadowMaps( rv, registry.getQueue( RenderQueue::General ) );
 
   //
   // Render scene.
 
-  real aspectRatio = 0.f;
   RenderTargetPtr rt = nullptr;
   if ( rv.camera->postProcessing ) {
     _api->setViewport( 0,
@@ -188,7 +124,6 @@ void Forward3DRenderer::present( const RenderView& rv,
                        static_cast<uint32_t>( rv.viewport.w * rv.camera->postProcessing->renderTarget->getWidth() ),
                        static_cast<uint32_t>( rv.viewport.h * rv.camera->postProcessing->renderTarget->getHeight() ) );
     rv.camera->postProcessing->renderTarget->bind();
-    aspectRatio = rv.camera->postProcessing->renderTarget->getAspectRatio();
 
     rt = rv.camera->postProcessing->renderTarget;
   } else if ( rv.renderTarget ) {
@@ -197,7 +132,6 @@ void Forward3DRenderer::present( const RenderView& rv,
                        static_cast< uint32_t >( rv.viewport.w * rv.renderTarget->getWidth() ),
                        static_cast< uint32_t >( rv.viewport.h * rv.renderTarget->getHeight() ) );
     rv.renderTarget->bind();
-    aspectRatio = rv.renderTarget->getAspectRatio();
 
     rt = rv.renderTarget;
   }
@@ -209,7 +143,6 @@ void Forward3DRenderer::present( const RenderView& rv,
                        rv.gl_viewport.height );
 
     _api->bindDefaultFramebuffer();
-    aspectRatio = rv.gl_viewport.aspectRatio;
   }
 
   Color bg = rv.scene->getSkyboxColor();
@@ -219,17 +152,9 @@ void Forward3DRenderer::present( const RenderView& rv,
   _api->setCullingMode( IRenderAPI::CullingMode::Back );
   _api->setDepthTestEnabled( true );
 
-  // Setup view-projection matrix.
-  // TODO: Take viewport dimensions into account. Cache more things inside window.
-  const glm::mat4 projection = glm::perspective( glm::radians( 45.f ),
-                                                 aspectRatio,
-                                                 0.1f, 20000.f );
-
-  const glm::mat4 viewProjection = projection * rv.camera->getViewMatrix();
-
   // Render all solids first.
-  for ( const auto& activeQueue : _activeQueues ) {
-    RenderQueue& queue = activeQueue.second;
+  for ( const auto& activeQueue : activeQueues ) {
+    RenderQueue& queue = *activeQueue.second;
     _renderSolids( rv, queue, viewProjection );
   }
 
@@ -243,8 +168,8 @@ void Forward3DRenderer::present( const RenderView& rv,
     // We don't want to render to the 2nd color output (bright buffer), so bloom isn't occluded by transparent objects.
     rt->setColorAttachmentCount( 1 );
   }
-  for ( const auto& activeQueue : _activeQueues ) {
-    RenderQueue& queue = activeQueue.second;
+  for ( const auto& activeQueue : activeQueues ) {
+    RenderQueue& queue = *activeQueue.second;
     _renderTransparents( rv, queue, viewProjection );
   }
   if ( rt ) {
@@ -262,8 +187,6 @@ void Forward3DRenderer::present( const RenderView& rv,
     rv.camera->postProcessing->renderTarget->flush();
     _presentPostProcessing( rv, window );
   }
-
-  _clearRenderQueues();
 }
 
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
@@ -379,26 +302,114 @@ void Forward3DRenderer::_presentPostProcessing( const RenderView& rv,
 
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
 
-void Forward3DRenderer::_clearRenderQueues()
+real Forward3DRenderer::_getAspectRatio( const RenderView& rv ) const
+{
+  // Match the target present() renders the scene into.
+  if ( rv.camera->postProcessing ) {
+    return rv.camera->postProcessing->renderTarget->getAspectRatio();
+  }
+  if ( rv.renderTarget ) {
+    return rv.renderTarget->getAspectRatio();
+  }
+
+  return rv.gl_viewport.aspectRatio;
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+void Forward3DRenderer::_updateDraws( RenderRegistry& registry, const bool full )
 {
-  // Remove all data from each queue.
-  for ( auto& queue : _queues ) {
-    queue.clear();
+  const ActiveRenderQueueList& activeQueues = registry.getActiveQueues();
+
+  if ( full ) {
+    for ( const auto& activeQueue : activeQueues ) {
+      RenderQueue& queue = *activeQueue.second;
+      for ( size_t i = 0; i < queue.draws.size(); ++i ) {
+        _updateDraw( queue.draws, static_cast< uint32_t >( i ) );
+      }
+
+      for ( auto& solid : queue.instancedSolids ) {
+        for ( size_t i = 0; i < solid.nodes.size(); ++i ) {
+          _updateInstance( solid, static_cast< uint32_t >( i ) );
+        }
+      }
+    }
+  }
+  else {
+    for ( const auto i : registry.getMoved() ) {
+      const RenderRegistry::Entry& entry = registry[i];
+      RenderQueue& queue = registry.getQueue( entry.queue );
+      if ( RenderRegistry::NoInstance == entry.instance ) {
+        _updateDraw( queue.draws, entry.slot );
+      }
+      else {
+        _updateInstance( queue.instancedSolids[entry.slot], entry.instance );
+      }
+    }
   }
 
-  // Erase all queues from the active queue list.
-  _activeQueues.clear();
+  // Repack the visible instances of instanced solids that changed.
+  for ( const auto& activeQueue : activeQueues ) {
+    for ( auto& solid : activeQueue.second->instancedSolids ) {
+      if ( !solid.stale ) {
+        continue;
+      }
+
+      solid.visibleMatrices.clear();
+      for ( size_t i = 0; i < solid.nodes.size(); ++i ) {
+        if ( solid.visible[i] ) {
+          solid.visibleMatrices.push_back( solid.nodes[i]->getFullTransform() );
+        }
+      }
+      solid.stale = false;
+    }
+  }
 }
 
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
 
-void Forward3DRenderer::_activateQueue( const uint id,
-                                        RenderQueue& rq )
+void Forward3DRenderer::_updateDraw( DrawList& draws, const uint32_t index )
 {
-  const auto lookup = _activeQueues.find( id );
-  if ( _activeQueues.end() == lookup ) {
-    _activeQueues.insert( { id, rq } );
+  const PrefabPtr prefab = draws.getItem( index ).first;
+  const NodePtr node = draws.getItem( index ).second;
+
+  const MaterialPtr material = prefab->getMaterial();
+  const bool blended = material->blendingMode.enabled;
+
+  // Blended instanced prefabs are drawn as a whole per node, so they are
+  // left alone.
+  bool visible = true;
+  if ( !( blended && prefab->isInstanced() ) ) {
+    ++_cullingStats.tested;
+    visible = IsVisible( _frustum, node );
+    if ( visible ) {
+      ++_cullingStats.visible;
+    }
   }
+  draws.setVisible( index, visible );
+
+  // Opaque draws are grouped by state then ordered front-to-back,
+  // blended draws are ordered back-to-front.
+  const real distance = glm::length2( _camera->getPosition() - node->getPosition() );
+  const uint64_t key = ( blended ) ?
+    RenderKey::Translucent( material->program, material, prefab->getModel(), distance ) :
+    RenderKey::Opaque( material->program, material, prefab->getModel(), distance );
+  draws.setKey( index, key );
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+void Forward3DRenderer::_updateInstance( RenderQueue::InstancedSolid& solid, const uint32_t instance )
+{
+  ++_cullingStats.tested;
+  const bool visible = IsVisible( _frustum, solid.nodes[instance] );
+  if ( visible ) {
+    ++_cullingStats.visible;
+  }
+
+  // The node moved or the view did, either way its matrix is repacked.
+  solid.visible[instance] = visible;
+  solid.stale = true;
 }
 
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
@@ -425,14 +436,17 @@ void Forward3DRenderer::_renderShadowMaps( const RenderView& rv,
                                        Vec3Zero,
                                        Vec3PosY );
 
-    GPUProgramPtr shadowProgram = StockResource::GetGPUProgram( "DirectionalShadowMapInstanced" );
+    GPUProgramPtr shadowProgram = StockResource::GetGPUProgram( "DirectionalShadowMapInstanced"_sid );
     shadowProgram->use();
 
     dirLight->viewProj = lightProj * lightView;
     shadowProgram->setUniformVar( "viewProjection", dirLight->viewProj );
 
+    const Frustum lightFrustum( dirLight->viewProj );
+
     // Instanced solids.
-    for ( const auto& prefab : queue.instancedSolids ) {
+    for ( const auto& solid : queue.instancedSolids ) {
+      const PrefabPtr prefab = solid.prefab;
       if ( !prefab->castShadows ) {
         continue;
       }
@@ -447,40 +461,21 @@ void Forward3DRenderer::_renderShadowMaps( const RenderView& rv,
       model->draw( shadowProgram, prefab->getInstanceCount(), false, false );
     }
 
-    shadowProgram = StockResource::GetGPUProgram( "DirectionalShadowMap" );
+    shadowProgram = StockResource::GetGPUProgram( "DirectionalShadowMap"_sid );
     shadowProgram->use();
     shadowProgram->setUniformVar( "viewProjection", dirLight->viewProj );
 
-    // Render non-instanced solids.
-    for ( auto& pair : queue.solids ) {
-      const PrefabPtr prefab = pair.first;
-      if ( !prefab->castShadows ) {
-        continue;
-      }
-
-      const RenderQueue::NodeList& nodes = pair.second;
-      const ModelPtr model = prefab->getModel();
-
-      // Render each node associated with this prefab.
-      for ( const auto& node : nodes ) {
-        shadowProgram->updateNodeUniforms( nullptr, node, dirLight->viewProj ); // Note: dirLight->viewProj not used.
-        model->draw( shadowProgram, 0, false, false );
-      }
-    }
-
-    // Render transparents.
-    // TODO: Account for shadow strength based on opacity...
-    for ( auto it = queue.transparents.rbegin(); it != queue.transparents.rend(); ++it ) {
-      const PrefabPtr prefab = it->second.first;
-      if ( !prefab->castShadows ) {
+    // Render every draw, including those culled from the camera's view.
+    // TODO: Account for shadow strength based on opacity of transparents...
+    for ( size_t i = 0; i < queue.draws.size(); ++i ) {
+      const PrefabPtr prefab = queue.draws[i].first;
+      const NodePtr node = queue.draws[i].second;
+      if ( !prefab->castShadows || ( !prefab->isInstanced() && !IsVisible( lightFrustum, node ) ) ) {
         continue;
       }
 
-      NodePtr node = it->second.second;
-      ModelPtr model = prefab->getModel();
-
       shadowProgram->updateNodeUniforms( nullptr, node, dirLight->viewProj ); // Note: dirLight->viewProj not used.
-      model->draw( shadowProgram, 0, false, false );
+      prefab->getModel()->draw( shadowProgram, 0, false, false );
     }
   }
 
@@ -501,16 +496,17 @@ void Forward3DRenderer::_renderShadowMaps( const RenderView& rv,
 
 
     // Instanced solids.
-    GPUProgramPtr shadowProgram = StockResource::GetGPUProgram( "OmnidirectionalShadowMapInstanced" );
+    GPUProgramPtr shadowProgram = StockResource::GetGPUProgram( "OmnidirectionalShadowMapInstanced"_sid );
     shadowProgram->use();
 
     for ( int i = 0; i < 6; ++i ) {
-      shadowProgram->setUniformVar( "shadowMatrices[" + std::to_string( i ) + "]", pointLight->shadowTransforms[i] );
+      shadowProgram->setUniformVar( ShadowMatrixNames[i], pointLight->shadowTransforms[i] );
     }
     shadowProgram->setUniformVar( "lightPos", lightPos );
     shadowProgram->setUniformVar( "farPlane", pointLight->shadowFarPlane );
 
-    for ( const auto& prefab : queue.instancedSolids ) {
+    for ( const auto& solid : queue.instancedSolids ) {
+      const PrefabPtr prefab = solid.prefab;
       if ( !prefab->castShadows ) {
         continue;
       }
@@ -526,46 +522,27 @@ void Forward3DRenderer::_renderShadowMaps( const RenderView& rv,
     }
 
     // Non-instanced solids.
-    shadowProgram = StockResource::GetGPUProgram( "OmnidirectionalShadowMap" );
+    shadowProgram = StockResource::GetGPUProgram( "OmnidirectionalShadowMap"_sid );
     shadowProgram->use();
 
     for ( int i = 0; i < 6; ++i ) {
-      shadowProgram->setUniformVar( "shadowMatrices[" + std::to_string( i ) + "]", pointLight->shadowTransforms[i] );
+      shadowProgram->setUniformVar( ShadowMatrixNames[i], pointLight->shadowTransforms[i] );
     }
     shadowProgram->setUniformVar( "lightPos", lightPos );
     shadowProgram->setUniformVar( "farPlane", pointLight->shadowFarPlane );
 
-    for ( auto& pair : queue.solids ) {
-      const PrefabPtr prefab = pair.first;
-      if ( !prefab->castShadows ) {
-        continue;
-      }
-
-      const RenderQueue::NodeList& nodes = pair.second;
-      const ModelPtr model = prefab->getModel();
-
-      // Render each node associated with this prefab.
-      glm::mat4 ident; // Not used in updater.
-      for ( const auto& node : nodes ) {
-        shadowProgram->updateNodeUniforms( nullptr, node, ident );
-        model->draw( shadowProgram, 0, false, false );
-      }
-    }
-
-    // Render transparents.
-    // TODO: Account for shadow strength based on opacity...
-    for ( auto it = queue.transparents.rbegin(); it != queue.transparents.rend(); ++it ) {
-      const PrefabPtr prefab = it->second.first;
-      if ( !prefab->castShadows ) {
+    // Every draw, including those culled from the camera's view.
+    // TODO: Account for shadow strength based on opacity of transparents...
+    glm::mat4 ident; // Not used in updater.
+    for ( size_t i = 0; i < queue.draws.size(); ++i ) {
+      const PrefabPtr prefab = queue.draws[i].first;
+      const NodePtr node = queue.draws[i].second;
+      if ( !prefab->castShadows || ( !prefab->isInstanced() && !IsInRange( lightPos, pointLight->shadowFarPlane, node ) ) ) {
         continue;
       }
 
-      NodePtr node = it->second.second;
-      ModelPtr model = prefab->getModel();
-
-      glm::mat4 ident; // Not used in updater.
       shadowProgram->updateNodeUniforms( nullptr, node, ident );
-      model->draw( shadowProgram, 0, false, false );
+      prefab->getModel()->draw( shadowProgram, 0, false, false );
     }
   }
 
@@ -578,7 +555,7 @@ void Forward3DRenderer::_renderSkybox( const RenderView& rv,
                                        const glm::mat4& viewProjection ) const
 {
   SkyboxPtr skybox = rv.scene->getSkybox();
-  ModelPtr model = StockResource::GetModel( "Skybox3D" );
+  ModelPtr model = StockResource::GetModel( "Skybox3D"_sid );
 
   _api->setDepthMaskEnabled( false );
 
@@ -626,7 +603,16 @@ void Forward3DRenderer::_renderSolids( const RenderView& rv,
   const ScenePtr scene = rv.scene;
 
   // Render instanced solids.
-  for ( const auto& prefab : queue.instancedSolids ) {
+  for ( const auto& solid : queue.instancedSolids ) {
+    if ( solid.visibleMatrices.empty() ) {
+      // Every instance is out of view.
+      continue;
+    }
+
+    // Draw the visible instances from their packed copy. The prefab's own
+    // buffer is indexed by instance ID and only rewritten for nodes that
+    // moved, it stays intact for the shadow passes.
+    const PrefabPtr prefab = solid.prefab;
     MaterialPtr material = prefab->getMaterial();
     ModelPtr model = prefab->getInstancedModel();
     GPUProgramPtr program = material->program;
@@ -639,28 +625,42 @@ void Forward3DRenderer::_renderSolids( const RenderView& rv,
     program->updateUniforms( rv, material, queue.lights );
     program->updateNodeUniforms( material, node, viewProjection );
 
-    model->draw( program, prefab->getInstanceCount() );
+    model->drawInstances( program, solid.visibleMatrices.data(), solid.visibleMatrices.size() );
   }
 
-  // Render non-instanced solids.
-  for ( auto& pair : queue.solids ) {
-    const PrefabPtr prefab = pair.first;
-    const RenderQueue::NodeList& nodes = pair.second;
+  // Render non-instanced solids. Draws are sorted by program, material then
+  // model, so state is only changed between groups.
+  GPUProgramPtr activeProgram = nullptr;
+  MaterialPtr activeMaterial = nullptr;
+  PrefabPtr activePrefab = nullptr;
 
-    const MaterialPtr material = prefab->getMaterial();
-    const ModelPtr model = prefab->getModel();
-    const GPUProgramPtr program = material->program;
+  for ( size_t i = 0; i < queue.draws.getOpaqueCount(); ++i ) {
+    if ( !queue.draws.isVisible( i ) ) {
+      continue;
+    }
 
-    _api->setCullingMode( prefab->cullingMode );
+    const PrefabPtr prefab = queue.draws[i].first;
+    const NodePtr node = queue.draws[i].second;
 
-    program->use();
-    program->updateUniforms( rv, material, queue.lights );
+    const MaterialPtr material = prefab->getMaterial();
+    const GPUProgramPtr program = material->program;
 
-    // Render each node associated with this prefab.
-    for ( const auto& node : nodes ) {
-      program->updateNodeUniforms( material, node, viewProjection );
-      model->draw( program );
+    if ( program != activeProgram ) {
+      program->use();
+      activeProgram = program;
+      activeMaterial = nullptr;
+    }
+    if ( material != activeMaterial ) {
+      program->updateUniforms( rv, material, queue.lights );
+      activeMaterial = material;
+    }
+    if ( prefab != activePrefab ) {
+      _api->setCullingMode( prefab->cullingMode );
+      activePrefab = prefab;
     }
+
+    program->updateNodeUniforms( material, node, viewProjection );
+    prefab->getModel()->draw( program );
   }
 }
 
@@ -672,10 +672,18 @@ void Forward3DRenderer::_renderTransparents( const RenderView& rv,
 {
   _api->setBlendingEnabled( true );
 
-  // Render in reverse order, so the farthest back is rendered first.
-  for ( auto it = queue.transparents.rbegin(); it != queue.transparents.rend(); ++it ) {
-    const PrefabPtr prefab = it->second.first;
-    NodePtr node = it->second.second;
+  GPUProgramPtr activeProgram = nullptr;
+  MaterialPtr activeMaterial = nullptr;
+  PrefabPtr activePrefab = nullptr;
+
+  // Translucent keys order the farthest back first, state only breaks ties.
+  for ( size_t i = queue.draws.getOpaqueCount(); i < queue.draws.size(); ++i ) {
+    if ( !queue.draws.isVisible( i ) ) {
+      continue;
+    }
+
+    const PrefabPtr prefab = queue.draws[i].first;
+    NodePtr node = queue.draws[i].second;
 
     const MaterialPtr material = prefab->getMaterial();
     GPUProgramPtr program = material->program;
@@ -689,21 +697,31 @@ void Forward3DRenderer::_renderTransparents( const RenderView& rv,
         throw Lore::Exception( "Instanced prefab must have an instanced model" );
 
       case Mesh::Type::QuadInstanced:
-        program = StockResource::GetGPUProgram( "StandardInstanced2D" );
+        program = StockResource::GetGPUProgram( "StandardInstanced2D"_sid );
         break;
 
       case Mesh::Type::TexturedQuadInstanced:
-        program = StockResource::GetGPUProgram( "StandardTexturedInstanced2D" );
+        program = StockResource::GetGPUProgram( "StandardTexturedInstanced2D"_sid );
         break;
       }
     }
 
-    // Set blending mode using material settings.
-    _api->setBlendingFunc( material->blendingMode.srcFactor, material->blendingMode.dstFactor );
-    _api->setCullingMode( prefab->cullingMode );
+    if ( program != activeProgram ) {
+      program->use();
+      activeProgram = program;
+      activeMaterial = nullptr;
+    }
+    if ( material != activeMaterial ) {
+      // Set blending mode using material settings.
+      _api->setBlendingFunc( material->blendingMode.srcFactor, material->blendingMode.dstFactor );
+      program->updateUniforms( rv, material, queue.lights );
+      activeMaterial = material;
+    }
+    if ( prefab != activePrefab ) {
+      _api->setCullingMode( prefab->cullingMode );
+      activePrefab = prefab;
+    }
 
-    program->use();
-    program->updateUniforms( rv, material, queue.lights );
     program->updateNodeUniforms( material, node, viewProjection );
 
     // Draw the prefab.
@@ -721,8 +739,8 @@ void Forward3DRenderer::_renderBoxes( const RenderQueue& queue,
   _api->setBlendingEnabled( true );
   _api->setBlendingFunc( BlendFactor::SrcAlpha, BlendFactor::OneMinusSrcAlpha );
 
-  GPUProgramPtr program = StockResource::GetGPUProgram( "StandardBox2D" );
-  ModelPtr model = StockResource::GetModel( "TexturedQuad" );
+  GPUProgramPtr program = StockResource::GetGPUProgram( "StandardBox2D"_sid );
+  ModelPtr model = StockResource::GetModel( "TexturedQuad"_sid );
 
   program->use();
 
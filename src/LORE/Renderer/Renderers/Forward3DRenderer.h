@@ -25,6 +25,7 @@
 // THE SOFTWARE.
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
 
+#include <LORE/Math/Math.h>
 #include <LORE/Renderer/Renderer.h>
 
 #include <LORE/Resource/Material.h>
@@ -33,11 +34,6 @@
 
 namespace Lore {
 
-  using RenderQueueList = std::vector<RenderQueue>;
-  using ActiveRenderQueueList = std::map<uint, RenderQueue&>;
-
-  // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
-
   ///
   /// \class Forward3DRenderer
   /// \brief A basic 3D forward renderer.
@@ -47,10 +43,16 @@ namespace Lore {
     void _presentPostProcessing( const RenderView& rv,
       const WindowPtr window );
 
-    void _clearRenderQueues() override;
+    real _getAspectRatio( const RenderView& rv ) const;
+
+    ///
+    /// \brief Refreshes the key and visibility of every draw in registry's
+    ///     queues if full, otherwise only those of draws that moved.
+    void _updateDraws( RenderRegistry& registry, const bool full );
 
-    void _activateQueue( const uint id,
-      RenderQueue& rq );
+    void _updateDraw( DrawList& draws, const uint32_t index );
+
+    void _updateInstance( RenderQueue::InstancedSolid& solid, const uint32_t instance );
 
     void _renderShadowMaps( const RenderView& rv,
       const RenderQueue& queue );
@@ -71,28 +73,16 @@ namespace Lore {
 
     // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
 
-    RenderQueueList _queues { };
-    ActiveRenderQueueList _activeQueues { };
-
     CameraPtr _camera { nullptr };
 
+    // The active camera's view frustum, nodes outside it are not drawn.
+    Frustum _frustum {};
+
   public:
 
-    Forward3DRenderer();
+    Forward3DRenderer() = default;
     ~Forward3DRenderer() override = default;
 
-    void addRenderData( PrefabPtr e,
-                        NodePtr node ) override;
-
-    void addBox( BoxPtr box,
-                 const glm::mat4& transform ) override;
-
-    void addTextbox( TextboxPtr textbox,
-                     const glm::mat4& transform ) override;
-
-    void addLight( LightPtr light,
-                   const NodePtr node ) override;
-
     void present( const RenderView& rv,
                   const WindowPtr window ) override;
 
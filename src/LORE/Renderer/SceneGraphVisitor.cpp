@@ -26,10 +26,10 @@
 
 #include "SceneGraphVisitor.h"
 
-#include <LORE/Renderer/Renderer.h>
-#include <LORE/Resource/Prefab.h>
+#include <LORE/Core/Context.h>
 #include <LORE/Scene/AABB.h>
 #include <LORE/Scene/Node.h>
+#include <LORE/Scene/Scene.h>
 
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
 
@@ -38,89 +38,64 @@ using namespace Lore;
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
 
 SceneGraphVisitor::SceneGraphVisitor( NodePtr root )
-  : _stack()
-  , _node( root )
+  : _root( root )
 {
-  if ( _node->_transformDirty() ) {
-    _node->_updateWorldTransform( _node->_getLocalTransform() );
-  }
-
-  // Recursively push down scale changes to child nodes. This must be done
-  // here because scales are not included in transform/rotation matrix updates.
-  _node->_updateChildrenScale();
 }
 
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
 
-void SceneGraphVisitor::visit( Renderer* renderer, bool parentDirty )
+void SceneGraphVisitor::visit()
 {
-  const bool transformDirty = _node->_transformDirty();
-  const glm::mat4 transform = _node->_getLocalTransform();
-
-  if ( parentDirty ) {
-    _node->_updateWorldTransform( _stack.top() * transform );
-    _node->_aabb->update();
-  }
-  else if ( transformDirty ) {
-    _node->_updateWorldTransform( _stack.top() * transform );
-    _node->_aabb->update();
-    parentDirty = true;
-  }
-
-  // Add any Renderables attached to this node to the Renderer.
-  auto it = _node->getPrefabListConstIterator();
-  while ( it.hasMore() ) {
-    PrefabPtr prefab = it.getNext();
-    // Ensure this prefab hasn't been reclaimed by the pool.
-    if ( prefab->inUse ) {
-      renderer->addRenderData( prefab, _node );
-
-      // Update instancing.
-      if ( prefab->isInstanced() ) {
-        // Applies node's transform to the buffer for instanced data.
-        prefab->updateInstancedMatrix( _node->_instanceID, _node->getFullTransform() );
+  auto& transforms = *_root->_transforms;
+  transforms.update();
+
+  // Rebuild the render queues first, so they hold every node that moved.
+  ScenePtr scene = _root->_scene;
+  RenderRegistry& registry = scene->_renderRegistry;
+  registry.update( scene );
+
+  // Without a job system (e.g., no active context) everything runs inline.
+  JobSystem* jobs = Context::GetJobSystem();
+  auto forEach = [jobs] ( const size_t count, const JobSystem::RangeFunction& body ) {
+    if ( jobs ) {
+      jobs->parallelFor( 0, count, GrainSize, body );
+    }
+    else if ( count ) {
+      body( 0, count );
+    }
+  };
+
+  // Refresh anything derived from the world transform of nodes that moved.
+  // Each node only touches its own bounds, lights and registry entries.
+  const auto& updated = transforms.getUpdated();
+  forEach( updated.size(), [&transforms, &updated, &registry] ( const size_t begin, const size_t end ) {
+    for ( size_t i = begin; i < end; ++i ) {
+      NodePtr node = transforms.getNode( updated[i] );
+      node->_updateWorldBounds();
+      if ( node->_aabb ) {
+        node->_aabb->update();
       }
+      node->_updateLightTransforms();
+      registry.updateTransforms( node );
     }
-  }
+  } );
 
-  auto boxIt = _node->getBoxListConstIterator();
-  while ( boxIt.hasMore() ) {
-    BoxPtr box = boxIt.getNext();
-    renderer->addBox( box, _node->getFullTransform() );
-  }
-
-  auto textboxIt = _node->getTextboxListConstIterator();
-  while ( textboxIt.hasMore() ) {
-    TextboxPtr textbox = textboxIt.getNext();
-    renderer->addTextbox( textbox, _node->getFullTransform() );
-  }
-
-  auto lightIt = _node->getLightListConstIterator();
-  while ( lightIt.hasMore() ) {
-    LightPtr light = lightIt.getNext();
-    renderer->addLight( light, _node );
+  // The spatial structures are not thread-safe, so they are refit afterwards.
+  if ( scene->_spatialIndex ) {
+    for ( const auto i : updated ) {
+      scene->_updateSpatialIndex( transforms.getNode( i ) );
+    }
   }
-
-  // Recurse over children.
-  if ( _node->hasChildNodes() ) {
-    // Push this node's transform onto the stack, so the next call can
-    // use it to calculate its derived transform.
-    const auto newTransform = ( _stack.empty() ) ? transform : _stack.top() * transform;
-    _stack.push( newTransform );
-
-    ChildNodeIterator it = _node->getChildNodeIterator();
-    while ( it.hasMore() ) {
-      _node = it.getNext();
-      visit( renderer, parentDirty );
+  if ( scene->_broadPhase ) {
+    for ( const auto i : updated ) {
+      scene->_updateBroadPhase( transforms.getNode( i ) );
     }
-
-    // Recursion on this node's children is done, we can pop off the transform.
-    _stack.pop();
   }
 
-  // Manually update depth value (z) in world transformation matrix after
-  // traversing all children.
-  //_node->_updateDepthValue();
+  // Renderers rekey and recull these draws.
+  for ( const auto i : updated ) {
+    registry.markMoved( transforms.getNode( i ) );
+  }
 }
 
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
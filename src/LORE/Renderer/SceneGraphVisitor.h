@@ -33,26 +33,35 @@ namespace Lore {
 
   ///
   /// \class SceneGraphVisitor
-  /// \brief Traverses a scene graph (e.g., a Node and all of its children) and
-  ///     carries down transformation updates as needed.
+  /// \brief Updates the transforms of a scene graph (e.g., a Node and all of
+  ///     its children) and keeps the scene's render queues in step.
+  /// \details World matrices are only recomputed for the subtrees under the
+  ///     TransformHierarchy's dirty roots. Only the nodes that moved then
+  ///     have their transforms written to the scene's RenderRegistry.
   class LORE_EXPORT SceneGraphVisitor
   {
 
-    std::stack<glm::mat4> _stack;
-    NodePtr _node;
+    NodePtr _root;
 
   public:
 
     ///
-    /// \brief Constructor that takes root node as parameter, updates its
-    ///     world transform, and updates the scale of all children.
+    /// \brief Number of updated nodes handled by a single job.
+    static constexpr size_t GrainSize = 512;
+
+    ///
+    /// \brief Constructor that takes the scene's root node as parameter.
     SceneGraphVisitor( NodePtr root );
     ~SceneGraphVisitor() = default;
 
     ///
-    /// \brief Recursive function which updates the transformation matrix
-    ///     of all child nodes.
-    void visit( Renderer* renderer, bool parentDirty = false );
+    /// \brief Updates the world transform of every dirty node and its
+    ///     children, then brings the scene's RenderRegistry up to date.
+    /// \details The registry is rebuilt if anything was attached or
+    ///     detached. Bounds, lights and registry transforms of the nodes that
+    ///     moved are refreshed in chunks of GrainSize nodes that run on the
+    ///     context's JobSystem.
+    void visit();
 
   };
 
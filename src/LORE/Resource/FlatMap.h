@@ -0,0 +1,441 @@
+#pragma once
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+// The MIT License (MIT)
+// This source file is part of LORE
+// ( Lightweight Object-oriented Rendering Engine )
+//
+// Copyright (c) 2017-2021 Jordan Sparks
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files ( the "Software" ), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+namespace Lore {
+
+  ///
+  /// \brief Number of entries a FlatMap stores inline before spilling to the heap.
+  template<size_t N>
+  using InlineCapacity = std::integral_constant<size_t, N>;
+
+  ///
+  /// \class FlatMap
+  /// \brief Map stored as a sorted array, with inline storage for the first
+  ///     few entries. Meant for maps that usually hold a handful of entries,
+  ///     where a tree or hash table costs more than it saves.
+  /// \details Entries are contiguous and iterated in key order. Iterators and
+  ///     pointers to entries are invalidated by insertion and removal. Keys
+  ///     and values must be trivially copyable, entries are moved with memcpy.
+  template<typename Key, typename T, typename InlineCount = InlineCapacity<4>>
+  class FlatMap final
+  {
+
+  public:
+
+    struct value_type
+    {
+      Key first;
+      T second;
+    };
+
+    using key_type = Key;
+    using mapped_type = T;
+    using size_type = size_t;
+    using iterator = value_type*;
+    using const_iterator = const value_type*;
+
+    static constexpr size_t InlineSize = InlineCount::value;
+
+    static_assert( std::is_trivially_copyable<Key>::value && std::is_trivially_copyable<T>::value,
+                   "FlatMap requires trivially copyable keys and values" );
+
+  private:
+
+    template<size_t N, typename Dummy = void>
+    struct InlineStorage
+    {
+      typename std::aligned_storage<sizeof( value_type ), alignof( value_type )>::type entries[N];
+
+      value_type* data()
+      {
+        return reinterpret_cast< value_type* >( entries );
+      }
+    };
+
+    template<typename Dummy>
+    struct InlineStorage<0, Dummy>
+    {
+      value_type* data()
+      {
+        return nullptr;
+      }
+    };
+
+    // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+    value_type* _data { nullptr };
+    u32 _size { 0 };
+    u32 _capacity { static_cast< u32 >( InlineSize ) };
+    InlineStorage<InlineSize> _inline {};
+
+    // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+    bool _isInline() const
+    {
+      return ( _capacity == InlineSize );
+    }
+
+    void _grow()
+    {
+      const u32 capacity = ( _capacity ) ? _capacity * 2 : 4;
+      value_type* data = static_cast< value_type* >( ::operator new( capacity * sizeof( value_type ) ) );
+      if ( _size ) {
+        std::memcpy( data, _data, _size * sizeof( value_type ) );
+      }
+
+      _free();
+      _data = data;
+      _capacity = capacity;
+    }
+
+    void _free()
+    {
+      if ( !_isInline() ) {
+        ::operator delete( _data );
+      }
+    }
+
+    void _copy( const FlatMap& rhs )
+    {
+      _data = _inline.data();
+      _capacity = static_cast< u32 >( InlineSize );
+      _size = 0;
+
+      if ( rhs._size > _capacity ) {
+        _data = static_cast< value_type* >( ::operator new( rhs._size * sizeof( value_type ) ) );
+        _capacity = rhs._size;
+      }
+
+      if ( rhs._size ) {
+        std::memcpy( _data, rhs._data, rhs._size * sizeof( value_type ) );
+      }
+      _size = rhs._size;
+    }
+
+    void _move( FlatMap& rhs )
+    {
+      if ( rhs._isInline() ) {
+        _copy( rhs );
+      }
+      else {
+        // Steal the heap block.
+        _data = rhs._data;
+        _size = rhs._size;
+        _capacity = rhs._capacity;
+      }
+
+      rhs._data = rhs._inline.data();
+      rhs._size = 0;
+      rhs._capacity = static_cast< u32 >( InlineSize );
+    }
+
+    iterator _lowerBound( const Key& key ) const
+    {
+      value_type* first = _data;
+      size_t count = _size;
+      while ( count ) {
+        const size_t step = count / 2;
+        value_type* it = first + step;
+        if ( it->first < key ) {
+          first = it + 1;
+          count -= step + 1;
+        }
+        else {
+          count = step;
+        }
+      }
+
+      return first;
+    }
+
+  public:
+
+    FlatMap()
+    {
+      _data = _inline.data();
+    }
+
+    FlatMap( const FlatMap& rhs )
+    {
+      _copy( rhs );
+    }
+
+    FlatMap( FlatMap&& rhs ) noexcept
+    {
+      _move( rhs );
+    }
+
+    ~FlatMap()
+    {
+      _free();
+    }
+
+    FlatMap& operator = ( const FlatMap& rhs )
+    {
+      if ( this != &rhs ) {
+        FlatMap copy( rhs );
+        _free();
+        _move( copy );
+      }
+      return *this;
+    }
+
+    FlatMap& operator = ( FlatMap&& rhs ) noexcept
+    {
+      if ( this != &rhs ) {
+        _free();
+        _move( rhs );
+      }
+      return *this;
+    }
+
+    //
+    // Iterators.
+
+    iterator begin()
+    {
+      return _data;
+    }
+
+    iterator end()
+    {
+      return _data + _size;
+    }
+
+    const_iterator begin() const
+    {
+      return _data;
+    }
+
+    const_iterator end() const
+    {
+      return _data + _size;
+    }
+
+    //
+    // Lookup.
+
+    iterator find( const Key& key )
+    {
+      iterator it = _lowerBound( key );
+      return ( it != end() && !( key < it->first ) ) ? it : end();
+    }
+
+    const_iterator find( const Key& key ) const
+    {
+      const_iterator it = _lowerBound( key );
+      return ( it != end() && !( key < it->first ) ) ? it : end();
+    }
+
+    size_t count( const Key& key ) const
+    {
+      return ( find( key ) != end() ) ? 1 : 0;
+    }
+
+    size_t size() const
+    {
+      return _size;
+    }
+
+    bool empty() const
+    {
+      return !_size;
+    }
+
+    //
+    // Modifiers.
+
+    ///
+    /// \brief Inserts the pair (anything with first and second members) if
+    ///     its key is not already present.
+    template<typename Pair>
+    std::pair<iterator, bool> insert( const Pair& pair )
+    {
+      iterator it = _lowerBound( pair.first );
+      if ( it != end() && !( pair.first < it->first ) ) {
+        return { it, false };
+      }
+
+      if ( _size == _capacity ) {
+        const size_t idx = it - _data;
+        _grow();
+        it = _data + idx;
+      }
+
+      // Shift the tail up to make room, keeping entries sorted.
+      std::memmove( it + 1, it, ( end() - it ) * sizeof( value_type ) );
+      it->first = pair.first;
+      it->second = pair.second;
+      ++_size;
+      return { it, true };
+    }
+
+    iterator erase( const_iterator pos )
+    {
+      iterator it = _data + ( pos - _data );
+      std::memmove( it, it + 1, ( end() - it - 1 ) * sizeof( value_type ) );
+      --_size;
+      return it;
+    }
+
+    size_t erase( const Key& key )
+    {
+      const_iterator it = find( key );
+      if ( it == end() ) {
+        return 0;
+      }
+
+      erase( it );
+      return 1;
+    }
+
+    void clear()
+    {
+      _size = 0;
+    }
+
+    void reserve( const size_t count )
+    {
+      if ( count <= _capacity ) {
+        return;
+      }
+
+      value_type* data = static_cast< value_type* >( ::operator new( count * sizeof( value_type ) ) );
+      if ( _size ) {
+        std::memcpy( data, _data, _size * sizeof( value_type ) );
+      }
+
+      _free();
+      _data = data;
+      _capacity = static_cast< u32 >( count );
+    }
+
+    ///
+    /// \brief Inserts every pair in [first, last) with a single sort and
+    ///     merge, instead of shifting the array once per pair. If any key is
+    ///     already present or repeated, nothing is inserted and false is
+    ///     returned.
+    template<typename ForwardIt>
+    bool insertUnique( ForwardIt first, ForwardIt last )
+    {
+      const size_t count = static_cast< size_t >( std::distance( first, last ) );
+      if ( !count ) {
+        return true;
+      }
+
+      const size_t total = _size + count;
+      if ( total <= InlineSize ) {
+        // Small batches stay inline, so check up front and insert one by one.
+        for ( ForwardIt it = first; it != last; ++it ) {
+          if ( find( it->first ) != end() || std::any_of( first, it, [&it] ( const auto& prev ) { return !( prev.first < it->first ) && !( it->first < prev.first ); } ) ) {
+            return false;
+          }
+        }
+        for ( ForwardIt it = first; it != last; ++it ) {
+          insert( *it );
+        }
+        return true;
+      }
+
+      // Sort the new pairs into the tail of a fresh block, then merge the
+      // existing entries in from the front. The write position never passes
+      // the next unread new pair, so the merge can run in place.
+      value_type* data = static_cast< value_type* >( ::operator new( total * sizeof( value_type ) ) );
+      value_type* incoming = data + _size;
+      size_t n = 0;
+      for ( ForwardIt it = first; it != last; ++it, ++n ) {
+        incoming[n].first = it->first;
+        incoming[n].second = it->second;
+      }
+
+      auto less = [] ( const value_type& a, const value_type& b ) {
+        return a.first < b.first;
+      };
+      std::sort( incoming, incoming + count, less );
+
+      bool unique = ( std::adjacent_find( incoming, incoming + count, [] ( const value_type& a, const value_type& b ) {
+        return !( a.first < b.first );
+      } ) == incoming + count );
+
+      size_t i = 0, j = 0, w = 0;
+      while ( unique && i < _size ) {
+        if ( j < count && incoming[j].first < _data[i].first ) {
+          data[w++] = incoming[j++];
+        }
+        else if ( j < count && !( _data[i].first < incoming[j].first ) ) {
+          unique = false;
+        }
+        else {
+          data[w++] = _data[i++];
+        }
+      }
+
+      if ( !unique ) {
+        ::operator delete( data );
+        return false;
+      }
+
+      // Whatever is left of the new pairs is already in place.
+      _free();
+      _data = data;
+      _size = static_cast< u32 >( total );
+      _capacity = static_cast< u32 >( total );
+      return true;
+    }
+
+    ///
+    /// \brief Removes every entry for which pred( entry ) is true in a single
+    ///     pass, returns the number removed.
+    template<typename Pred>
+    size_t eraseIf( Pred pred )
+    {
+      value_type* out = _data;
+      for ( value_type* it = _data; it != end(); ++it ) {
+        if ( !pred( *it ) ) {
+          if ( out != it ) {
+            *out = *it;
+          }
+          ++out;
+        }
+      }
+
+      const size_t removed = static_cast< size_t >( end() - out );
+      _size = static_cast< u32 >( out - _data );
+      return removed;
+    }
+
+  };
+
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
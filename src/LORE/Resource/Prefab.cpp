@@ -29,6 +29,7 @@
 #include <LORE/Resource/Material.h>
 #include <LORE/Resource/ResourceController.h>
 #include <LORE/Resource/StockResource.h>
+#include <LORE/Scene/RenderRegistry.h>
 
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
 
@@ -44,6 +45,9 @@ Prefab::~Prefab()
   }
 
   disableInstancing();
+
+  // Scenes may still hold draws of this prefab.
+  RenderRegistry::Invalidate();
 }
 
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
@@ -83,6 +87,8 @@ void Prefab::enableInstancing( const size_t max )
    return;
   }
 
+  RenderRegistry::Invalidate();
+
   // Create an instanced model.
   auto rc = Resource::GetResourceController();
   _instancedModel = rc->create<Model>( _name + "_instanced", getResourceGroupName() );
@@ -158,6 +164,7 @@ void Prefab::disableInstancing()
   if ( isInstanced() ) {
     Resource::DestroyModel( _instancedModel );
     _instancedModel = nullptr;
+    RenderRegistry::Invalidate();
   }
   _instanceCount = 0;
   _instanceControllerNode = nullptr;
@@ -181,6 +188,8 @@ void Prefab::setSprite( SpritePtr sprite )
   if ( _material->sprite->getTextureCount( 0, Texture::Type::Normal ) > 0 ) {
     _material->program = StockResource::GetGPUProgram( "StandardTexturedNormalMapping3D" );
   }
+
+  RenderRegistry::Invalidate();
 }
 
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
@@ -188,6 +197,7 @@ void Prefab::setSprite( SpritePtr sprite )
 void Prefab::setMaterial( MaterialPtr material )
 {
   _material = material;
+  RenderRegistry::Invalidate();
 }
 
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
@@ -195,6 +205,15 @@ void Prefab::setMaterial( MaterialPtr material )
 void Prefab::setModel( ModelPtr buffer )
 {
   _model = buffer;
+  RenderRegistry::Invalidate();
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+void Prefab::setRenderQueue( const uint queue )
+{
+  _renderQueue = queue;
+  RenderRegistry::Invalidate();
 }
 
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
@@ -38,6 +38,7 @@ namespace Lore {
   {
 
     friend class Node;
+    friend class Scene;
 
   public:
 
@@ -97,10 +98,13 @@ namespace Lore {
     void setSprite( SpritePtr sprite );
 
     //
-    // Modifiers.
+    // Modifiers. These move the prefab's draws to the right render lists; a
+    // material changed in place after attaching (e.g., enabling blending)
+    // needs a call to RenderRegistry::Invalidate().
 
     void setMaterial( MaterialPtr material ); 
     void setModel( ModelPtr buffer );
+    void setRenderQueue( const uint queue );
 
     //
     // Accessors.
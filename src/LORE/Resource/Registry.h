@@ -26,76 +26,136 @@
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
 
 #include <LORE/Core/Iterator.h>
+#include <LORE/Memory/Handle.h>
+#include <LORE/Resource/FlatMap.h>
 #include <LORE/Util/Util.h>
 
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
 
 namespace Lore {
 
-  using ID = string;
+  using ID = StringId;
+
+  ///
+  /// \struct RegistryValue
+  /// \brief Selects how a Registry stores its values: pooled objects are
+  ///     stored by pointer, handles and shared pointers by value.
+  template<typename T>
+  struct RegistryValue
+  {
+    using Type = T*;
+  };
+
+  template<typename T>
+  struct RegistryValue<Handle<T>>
+  {
+    using Type = Handle<T>;
+  };
+
+  template<typename T>
+  struct RegistryValue<std::shared_ptr<T>>
+  {
+    using Type = std::shared_ptr<T>;
+  };
+
+  // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
 
   ///
   /// \class Registry
   /// \brief Generic container class supporting multiple map types.
+  /// \details Values are keyed by the case-insensitive StringId of their name,
+  ///     so lookups by string or literal never allocate. Use FlatMap as the
+  ///     map type for small registries, e.g. Registry<FlatMap, Node, InlineCapacity<4>>.
   template<template <typename ...> class MapType, typename T, typename ... MapParams>
   class Registry
   {
 
-    MapType<string, T*, MapParams ...> _container {};
-    MapType<string, u32> _count {};
+  public:
+
+    using ValueType = typename RegistryValue<T>::Type;
+
+  private:
+
+    MapType<ID, ValueType, MapParams ...> _container {};
 
   public:
 
-    using Iterator = MapIterator<MapType<string, T*, MapParams ...>>;
-    using ConstIterator = ConstMapIterator<MapType<string, T*, MapParams ...>>;
+    using Iterator = MapIterator<MapType<ID, ValueType, MapParams ...>>;
+    using ConstIterator = ConstMapIterator<MapType<ID, ValueType, MapParams ...>>;
 
     // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
 
     Registry() = default;
 
-    void insert( const ID& id, T* resource, const bool autoDuplicate = false )
+    void insert( const string& name, ValueType resource, const bool autoDuplicate = false )
     {
-      auto transformedID = StringUtil::ToLower( id );
-      if ( _container.find( transformedID ) != _container.end() ) {
-        if ( autoDuplicate ) {
-          auto count = _count[id];
-          transformedID.append( std::to_string( count ) );
-        }
-        else {
-          throw Lore::Exception( "Resource with id " + transformedID + " already exists" );
+      ID id = StringId::InternDebug( name );
+      if ( _container.find( id ) != _container.end() ) {
+        if ( !autoDuplicate ) {
+          throw Lore::Exception( "Resource with id " + name + " already exists" );
         }
+
+        // Number the duplicate with the first free suffix.
+        u32 count = 1;
+        string uniqueName;
+        do {
+          uniqueName = name + std::to_string( count++ );
+        } while ( _container.find( StringId( uniqueName ) ) != _container.end() );
+        id = StringId::InternDebug( uniqueName );
       }
 
-      auto it = _container.begin();
-      _container.insert( it, std::pair<ID, T*>( transformedID, resource ) );
-      ++_count[id];
+      _container.insert( std::pair<ID, ValueType>( id, resource ) );
+    }
+
+    ///
+    /// \brief Inserts a batch of (ID, value) pairs at once. Throws, leaving
+    ///     the registry unchanged, if any id already exists or is repeated.
+    ///     FlatMap registries only.
+    template<typename ForwardIt>
+    void insert( ForwardIt first, ForwardIt last )
+    {
+      if ( !_container.insertUnique( first, last ) ) {
+        throw Lore::Exception( "Batch contains a resource id which already exists" );
+      }
     }
 
     void remove( const ID& id )
     {
-      const auto transformedID = StringUtil::ToLower( id );
-      auto lookup = _container.find( transformedID );
+      auto lookup = _container.find( id );
       if ( _container.end() == lookup ) {
-        //LogWrite( Warning, "Tried to remove resource with id %s which does not exist", transformedID.c_str() );
+        //LogWrite( Warning, "Tried to remove resource with id %s which does not exist", id.getName().c_str() );
         return;
       }
 
-      _container.erase( transformedID );
-      --_count[id];
+      _container.erase( lookup );
+    }
+
+    ///
+    /// \brief Removes every value for which pred( value ) is true, returns
+    ///     the number removed. FlatMap registries only.
+    template<typename Pred>
+    size_t removeIf( Pred pred )
+    {
+      return _container.eraseIf( [&pred] ( const auto& entry ) {
+        return pred( entry.second );
+      } );
     }
 
     void clear()
     {
       _container.clear();
-      _count.clear();
     }
 
-    T* get( const ID& id ) const
+    void reserve( const size_t count )
+    {
+      _container.reserve( count );
+    }
+
+    ValueType get( const ID& id ) const
     {
-      const auto transformedID = StringUtil::ToLower( id );
-      auto lookup = _container.find( transformedID );
+      auto lookup = _container.find( id );
       if ( _container.end() == lookup ) {
-        throw Lore::ItemIdentityException( "Resource with id " + transformedID + " does not exist" );
+        throw Lore::ItemIdentityException( "Resource with id " + id.getName() + " does not exist" );
       }
 
       return lookup->second;
@@ -103,7 +163,7 @@ namespace Lore {
 
     bool exists( const ID& id ) const
     {
-      return ( _container.find( StringUtil::ToLower( id ) ) != _container.end() );
+      return ( _container.find( id ) != _container.end() );
     }
 
     size_t size() const
@@ -128,11 +188,7 @@ namespace Lore {
 
     Registry clone()
     {
-      Registry clone;
-      for ( auto pair : _container ) {
-        clone.insert( pair.first, pair.second );
-      }
-      return clone;
+      return Registry( *this );
     }
 
     //
@@ -143,10 +199,496 @@ namespace Lore {
 
   };
 
+  // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
   ///
   /// \class SafeRegistry
   /// \brief Thread-safe version of Registry.
+  /// \details The whole registry is one immutable hash table, published
+  ///     through a single atomic pointer (RCU-style). Lookups load that
+  ///     pointer once and never take a lock or retry, so they never wait on
+  ///     a writer. Writers are serialized and publish a new table; buckets
+  ///     are grouped into pages which the new table shares with the old one,
+  ///     so a write only copies the page and bucket it changes. Iterators
+  ///     hold the table that was current when they were created, and do not
+  ///     observe later changes.
+  template<typename T>
+  class SafeRegistry
+  {
+
+  public:
+
+    using ValueType = typename RegistryValue<T>::Type;
+    using Entry = std::pair<ID, ValueType>;
+
+  private:
+
+    ///
+    /// \class AtomicPtr
+    /// \brief A shared_ptr which is loaded and stored atomically.
+    template<typename P>
+    class AtomicPtr
+    {
+
+#ifdef __cpp_lib_atomic_shared_ptr
+      std::atomic<std::shared_ptr<P>> _ptr {};
+#else
+      std::shared_ptr<P> _ptr {};
+#endif
+
+    public:
+
+      AtomicPtr() = default;
+
+      explicit AtomicPtr( std::shared_ptr<P> ptr )
+      : _ptr( std::move( ptr ) )
+      { }
+
+      std::shared_ptr<P> load() const
+      {
+#ifdef __cpp_lib_atomic_shared_ptr
+        return _ptr.load( std::memory_order_acquire );
+#else
+        return std::atomic_load_explicit( &_ptr, std::memory_order_acquire );
+#endif
+      }
+
+      void store( std::shared_ptr<P> ptr )
+      {
+#ifdef __cpp_lib_atomic_shared_ptr
+        _ptr.store( std::move( ptr ), std::memory_order_release );
+#else
+        std::atomic_store_explicit( &_ptr, std::move( ptr ), std::memory_order_release );
+#endif
+      }
+
+    };
+
+    static constexpr const size_t PageSize = 64;
+    static constexpr const size_t MinBucketCount = PageSize;
+
+    // Empty buckets and pages are null.
+    using Bucket = std::vector<Entry>;
+    using BucketPtr = std::shared_ptr<const Bucket>;
+
+    struct Page
+    {
+      BucketPtr buckets[PageSize];
+    };
+
+    using PagePtr = std::shared_ptr<Page>;
+
+    ///
+    /// \struct Table
+    /// \brief One version of the registry. Once published, neither the table
+    ///     nor the pages and buckets it points to are modified again.
+    struct Table
+    {
+      using key_type = ID;
+      using mapped_type = ValueType;
+
+      std::vector<PagePtr> pages {};
+      size_t mask { 0 };
+      size_t size { 0 };
+
+      explicit Table( const size_t bucketCount )
+      : pages( bucketCount / PageSize )
+      , mask( bucketCount - 1 )
+      { }
+
+      size_t getIndex( const ID& id ) const
+      {
+        const u64 hash = id.getHash();
+        return ( static_cast< size_t >( hash ^ ( hash >> 32 ) ) & mask );
+      }
+
+      const Bucket* getBucket( const size_t i ) const
+      {
+        const auto& page = pages[i / PageSize];
+        return ( page ) ? page->buckets[i % PageSize].get() : nullptr;
+      }
+
+      const Entry* find( const ID& id ) const
+      {
+        if ( const auto bucket = getBucket( getIndex( id ) ) ) {
+          for ( const auto& entry : *bucket ) {
+            if ( entry.first == id ) {
+              return &entry;
+            }
+          }
+        }
+        return nullptr;
+      }
+    };
+
+    using TablePtr = std::shared_ptr<const Table>;
+
+    ///
+    /// \class Cursor
+    /// \brief Walks the entries of a table bucket by bucket.
+    class Cursor
+    {
+
+      const Table* _table { nullptr };
+      size_t _bucket { 0 };
+      size_t _entry { 0 };
+
+      void _skipEmpty()
+      {
+        while ( _bucket <= _table->mask ) {
+          if ( !_table->pages[_bucket / PageSize] ) {
+            _bucket = ( _bucket / PageSize + 1 ) * PageSize;
+            _entry = 0;
+            continue;
+          }
+          const auto bucket = _table->getBucket( _bucket );
+          if ( bucket && _entry < bucket->size() ) {
+            return;
+          }
+          ++_bucket;
+          _entry = 0;
+        }
+      }
+
+    public:
+
+      Cursor( const Table* table, const size_t bucket )
+      : _table( table )
+      , _bucket( bucket )
+      {
+        _skipEmpty();
+      }
+
+      const Entry* operator -> () const
+      {
+        return &( *_table->getBucket( _bucket ) )[_entry];
+      }
+
+      Cursor& operator ++ ()
+      {
+        ++_entry;
+        _skipEmpty();
+        return *this;
+      }
+
+      Cursor operator ++ ( int )
+      {
+        Cursor previous( *this );
+        ++( *this );
+        return previous;
+      }
+
+      bool operator == ( const Cursor& rhs ) const
+      {
+        return ( _bucket == rhs._bucket && _entry == rhs._entry );
+      }
+
+      bool operator != ( const Cursor& rhs ) const
+      {
+        return !( *this == rhs );
+      }
+
+    };
+
+    ///
+    /// \class Draft
+    /// \brief The next table, built by a writer. Pages are shared with the
+    ///     published table until the draft first writes to them.
+    class Draft
+    {
+
+      std::shared_ptr<Table> _table;
+      std::vector<bool> _owned;
+
+      BucketPtr& _editBucket( const size_t i )
+      {
+        auto& page = _table->pages[i / PageSize];
+        if ( !_owned[i / PageSize] ) {
+          page = ( page ) ? std::make_shared<Page>( *page ) : std::make_shared<Page>();
+          _owned[i / PageSize] = true;
+        }
+        return page->buckets[i % PageSize];
+      }
+
+    public:
+
+      explicit Draft( const Table& published )
+      : _table( std::make_shared<Table>( published ) )
+      , _owned( _table->pages.size(), false )
+      { }
+
+      explicit Draft( const size_t bucketCount )
+      : _table( std::make_shared<Table>( bucketCount ) )
+      , _owned( _table->pages.size(), false )
+      { }
+
+      const Table& get() const
+      {
+        return *_table;
+      }
+
+      TablePtr publish()
+      {
+        return std::move( _table );
+      }
+
+      // Grows the table so count entries fit under a load factor of one.
+      void reserve( const size_t count )
+      {
+        size_t bucketCount = _table->mask + 1;
+        if ( count <= bucketCount ) {
+          return;
+        }
+        while ( bucketCount < count ) {
+          bucketCount *= 2;
+        }
+
+        Draft grown( bucketCount );
+        for ( Cursor it( _table.get(), 0 ), end( _table.get(), _table->mask + 1 ); it != end; ++it ) {
+          grown.insert( it->first, it->second );
+        }
+        *this = std::move( grown );
+      }
+
+      void insert( const ID& id, ValueType value )
+      {
+        auto& slot = _editBucket( _table->getIndex( id ) );
+        auto next = ( slot ) ? std::make_shared<Bucket>( *slot ) : std::make_shared<Bucket>();
+        next->emplace_back( id, std::move( value ) );
+        slot = std::move( next );
+        ++_table->size;
+      }
+
+      void remove( const ID& id )
+      {
+        const size_t i = _table->getIndex( id );
+        const auto bucket = _table->getBucket( i );
+        if ( !bucket ) {
+          return;
+        }
+
+        auto lookup = std::find_if( bucket->begin(), bucket->end(), [&id] ( const Entry& entry ) {
+          return entry.first == id;
+        } );
+        if ( bucket->end() == lookup ) {
+          return;
+        }
+
+        auto next = std::make_shared<Bucket>();
+        next->reserve( bucket->size() - 1 );
+        next->insert( next->end(), bucket->begin(), lookup );
+        next->insert( next->end(), lookup + 1, bucket->end() );
+        _editBucket( i ) = ( next->empty() ) ? nullptr : std::move( next );
+        --_table->size;
+      }
+
+    };
+
+    AtomicPtr<const Table> _table { std::make_shared<const Table>( MinBucketCount ) };
+    std::mutex _writeMutex {};
+
+  public:
+
+    ///
+    /// \class ConstIterator
+    /// \brief Iterates one version of the registry, holding a reference to it.
+    class ConstIterator : public MapIteratorWrapper<Table, Cursor>
+    {
+
+      TablePtr _table;
+
+    public:
+
+      explicit ConstIterator( TablePtr table )
+      : MapIteratorWrapper<Table, Cursor>( Cursor( table.get(), 0 ), Cursor( table.get(), table->mask + 1 ) )
+      , _table( std::move( table ) )
+      { }
+
+    };
+
+    // Tables are immutable, so both iterator types are read-only.
+    using Iterator = ConstIterator;
+
+    // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+    SafeRegistry() = default;
+
+    // Tables are immutable, so copies share the current one.
+    SafeRegistry( const SafeRegistry& rhs )
+    : _table( rhs._table.load() )
+    { }
+
+    SafeRegistry& operator = ( const SafeRegistry& rhs )
+    {
+      if ( this != &rhs ) {
+        auto table = rhs._table.load();
+        std::lock_guard<std::mutex> lock( _writeMutex );
+        _table.store( std::move( table ) );
+      }
+      return *this;
+    }
+
+    //
+    // Writers.
+
+    void insert( const string& name, ValueType resource, const bool autoDuplicate = false )
+    {
+      std::lock_guard<std::mutex> lock( _writeMutex );
+      Draft draft( *_table.load() );
+
+      ID id = StringId::InternDebug( name );
+      if ( draft.get().find( id ) ) {
+        if ( !autoDuplicate ) {
+          throw Lore::Exception( "Resource with id " + name + " already exists" );
+        }
+
+        // Number the duplicate with the first free suffix.
+        u32 count = 1;
+        string uniqueName;
+        do {
+          uniqueName = name + std::to_string( count++ );
+        } while ( draft.get().find( StringId( uniqueName ) ) );
+        id = StringId::InternDebug( uniqueName );
+      }
+
+      draft.reserve( draft.get().size + 1 );
+      draft.insert( id, std::move( resource ) );
+      _table.store( draft.publish() );
+    }
+
+    ///
+    /// \brief Inserts a batch of (ID, value) pairs at once. Throws, leaving
+    ///     the registry unchanged, if any id already exists or is repeated.
+    template<typename ForwardIt>
+    void insert( ForwardIt first, ForwardIt last )
+    {
+      std::lock_guard<std::mutex> lock( _writeMutex );
+      Draft draft( *_table.load() );
+
+      std::unordered_set<ID> batch;
+      for ( auto it = first; it != last; ++it ) {
+        if ( draft.get().find( it->first ) || !batch.insert( it->first ).second ) {
+          throw Lore::Exception( "Batch contains a resource id which already exists" );
+        }
+      }
+
+      draft.reserve( draft.get().size + batch.size() );
+      for ( auto it = first; it != last; ++it ) {
+        draft.insert( it->first, it->second );
+      }
+      _table.store( draft.publish() );
+    }
+
+    ///
+    /// \brief Returns the value with this id, inserting the result of
+    ///     create() under it first if there is none. create() is only
+    ///     called while holding the writer lock, so it runs at most once per id.
+    template<typename Func>
+    ValueType getOrInsert( const ID& id, Func&& create )
+    {
+      if ( const auto entry = _table.load()->find( id ) ) {
+        return entry->second;
+      }
+
+      std::lock_guard<std::mutex> lock( _writeMutex );
+      Draft draft( *_table.load() );
+      if ( const auto entry = draft.get().find( id ) ) {
+        return entry->second;
+      }
+
+      ValueType value = create();
+      draft.reserve( draft.get().size + 1 );
+      draft.insert( id, value );
+      _table.store( draft.publish() );
+      return value;
+    }
+
+    void remove( const ID& id )
+    {
+      std::lock_guard<std::mutex> lock( _writeMutex );
+      Draft draft( *_table.load() );
+      draft.remove( id );
+      _table.store( draft.publish() );
+    }
+
+    ///
+    /// \brief Removes every id in the range, ids that don't exist are skipped.
+    template<typename ForwardIt>
+    void remove( ForwardIt first, ForwardIt last )
+    {
+      std::lock_guard<std::mutex> lock( _writeMutex );
+      Draft draft( *_table.load() );
+      for ( auto it = first; it != last; ++it ) {
+        draft.remove( *it );
+      }
+      _table.store( draft.publish() );
+    }
+
+    void clear()
+    {
+      std::lock_guard<std::mutex> lock( _writeMutex );
+      _table.store( std::make_shared<const Table>( MinBucketCount ) );
+    }
+
+    void reserve( const size_t count )
+    {
+      std::lock_guard<std::mutex> lock( _writeMutex );
+      Draft draft( *_table.load() );
+      draft.reserve( count );
+      _table.store( draft.publish() );
+    }
+
+    //
+    // Readers.
+
+    ValueType get( const ID& id ) const
+    {
+      const auto table = _table.load();
+      const auto entry = table->find( id );
+      if ( !entry ) {
+        throw Lore::ItemIdentityException( "Resource with id " + id.getName() + " does not exist" );
+      }
+
+      return entry->second;
+    }
+
+    bool exists( const ID& id ) const
+    {
+      return ( nullptr != _table.load()->find( id ) );
+    }
+
+    size_t size() const
+    {
+      return _table.load()->size;
+    }
+
+    bool empty() const
+    {
+      return ( 0 == size() );
+    }
+
+    Iterator getIterator() const
+    {
+      return Iterator( _table.load() );
+    }
+
+    ConstIterator getConstIterator() const
+    {
+      return ConstIterator( _table.load() );
+    }
+
+    SafeRegistry clone() const
+    {
+      return SafeRegistry( *this );
+    }
+
+  };
+
+  template<typename T>
+  constexpr const size_t SafeRegistry<T>::PageSize;
 
+  template<typename T>
+  constexpr const size_t SafeRegistry<T>::MinBucketCount;
 
 }
 
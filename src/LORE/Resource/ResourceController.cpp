@@ -46,6 +46,12 @@ namespace LocalNS {
 
   static ContextPtr ActiveContext = nullptr;
 
+  static std::shared_ptr<ResourceGroup> CreateResourceGroup( const string& name )
+  {
+    StringId::Intern( name );
+    return std::make_shared<ResourceGroup>( name );
+  }
+
 }
 using namespace LocalNS;
 
@@ -64,6 +70,7 @@ ResourceGroup::ResourceGroup( const string& name )
   _addResourceType<GPUProgram>();
   _addResourceType<RenderTarget>();
   _addResourceType<Shader>();
+  _addResourceType<Sprite>();
   _addResourceType<Textbox>();
   _addResourceType<Texture>();
   _addResourceType<SpriteAnimationSet>();
@@ -93,12 +100,10 @@ const string ResourceController::DefaultGroupName = "Core";
 
 ResourceController::ResourceController()
 {
-  // Create default resource group.
-  auto rg = std::make_shared<ResourceGroup>(DefaultGroupName);
-
-  // Store and set to active group.
-  _groups.insert( { DefaultGroupName, rg } );
-  _defaultGroup = rg.get();
+  // Create default resource group and set it to active group.
+  _defaultGroup = _groups.getOrInsert( DefaultGroupName, [] {
+    return CreateResourceGroup( DefaultGroupName );
+  } ).get();
 
   _workingDirectory = "./";
 }
@@ -113,8 +118,9 @@ ResourceController::~ResourceController()
 
 void ResourceController::createGroup( const string& groupName )
 {
-  auto rg = std::make_shared<ResourceGroup>( groupName );
-  _groups.insert( { groupName, rg } );
+  _groups.getOrInsert( groupName, [&groupName] {
+    return CreateResourceGroup( groupName );
+  } );
 }
 
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
@@ -124,7 +130,7 @@ void ResourceController::destroyGroup( const string& groupName )
   auto group = _getGroup( groupName );
   if ( DefaultGroupName != group->getName() ) {
     unloadGroup( groupName );
-    _groups.erase( _groups.find( groupName ) );
+    _groups.remove( groupName );
   }
 }
 
@@ -254,15 +260,23 @@ void ResourceController::indexResourceFile( const string& file, const string& gr
 
 ResourceGroupPtr ResourceController::_getGroup( const string& groupName )
 {
-  auto lookup = _groups.find( groupName );
-  if ( _groups.end() != lookup ) {
-    return lookup->second.get();
-  }
+  return _groups.getOrInsert( groupName, [&groupName] {
+    LogWrite( Info, "Resource group %s not found, creating resource group", groupName.c_str() );
+    return CreateResourceGroup( groupName );
+  } ).get();
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
 
-  LogWrite( Info, "Resource group %s not found, creating resource group", groupName.c_str() );
-  auto rg = std::make_shared<ResourceGroup>( groupName );
-  _groups.insert( { groupName, rg } );
-  return rg.get();
+ResourceGroupPtr ResourceController::_getGroup( const StringId& groupName )
+{
+  return _groups.getOrInsert( groupName, [&groupName] {
+    // Key the new group by the id itself, its name is only as good as the
+    // name table (a hex placeholder if the id was never interned).
+    const string name = groupName.getName();
+    LogWrite( Info, "Resource group %s not found, creating resource group", name.c_str() );
+    return std::make_shared<ResourceGroup>( name );
+  } ).get();
 }
 
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
@@ -622,91 +636,91 @@ TextboxPtr Resource::CreateTextbox( const string& name, const string& groupName
 
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
 
-BoxPtr Resource::GetBox( const string& name, const string& groupName )
+BoxPtr Resource::GetBox( const StringId& name, const StringId& groupName )
 {
   return ActiveContext->getResourceController()->get<Box>( name, groupName );
 }
 
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
 
-PrefabPtr Resource::GetPrefab( const string& name, const string& groupName )
+PrefabPtr Resource::GetPrefab( const StringId& name, const StringId& groupName )
 {
   return ActiveContext->getResourceController()->get<Prefab>( name, groupName );
 }
 
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
 
-FontPtr Resource::GetFont( const string& name, const string& groupName )
+FontPtr Resource::GetFont( const StringId& name, const StringId& groupName )
 {
   return ActiveContext->getResourceController()->get<Font>( name, groupName );
 }
 
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
 
-GPUProgramPtr Resource::GetGPUProgram( const string& name, const string& groupName )
+GPUProgramPtr Resource::GetGPUProgram( const StringId& name, const StringId& groupName )
 {
   return ActiveContext->getResourceController()->get<GPUProgram>( name, groupName );
 }
 
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
 
-MaterialPtr Resource::GetMaterial( const string& name, const string& groupName )
+MaterialPtr Resource::GetMaterial( const StringId& name, const StringId& groupName )
 {
   return ActiveContext->getResourceController()->get<Material>( name, groupName );
 }
 
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
 
-MeshPtr Resource::GetMesh( const string& name, const string& groupName )
+MeshPtr Resource::GetMesh( const StringId& name, const StringId& groupName )
 {
   return ActiveContext->getResourceController()->get<Mesh>( name, groupName );
 }
 
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
 
-ModelPtr Resource::GetModel( const string& name, const string& groupName )
+ModelPtr Resource::GetModel( const StringId& name, const StringId& groupName )
 {
   return ActiveContext->getResourceController()->get<Model>( name, groupName );
 }
 
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
 
-RenderTargetPtr Resource::GetRenderTarget( const string& name, const string& groupName )
+RenderTargetPtr Resource::GetRenderTarget( const StringId& name, const StringId& groupName )
 {
   return ActiveContext->getResourceController()->get<RenderTarget>( name, groupName );
 }
 
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
 
-ShaderPtr Resource::GetShader( const string& name, const string& groupName )
+ShaderPtr Resource::GetShader( const StringId& name, const StringId& groupName )
 {
   return ActiveContext->getResourceController()->get<Shader>( name, groupName );
 }
 
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
 
-SpritePtr Resource::GetSprite( const string& name, const string& groupName )
+SpritePtr Resource::GetSprite( const StringId& name, const StringId& groupName )
 {
   return ActiveContext->getResourceController()->get<Sprite>( name, groupName );
 }
 
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
 
-SpriteAnimationSetPtr Resource::GetSpriteAnimationSet( const string& name, const string& groupName )
+SpriteAnimationSetPtr Resource::GetSpriteAnimationSet( const StringId& name, const StringId& groupName )
 {
   return ActiveContext->getResourceController()->get<SpriteAnimationSet>( name, groupName );
 }
 
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
 
-TexturePtr Resource::GetTexture( const string& name, const string& groupName )
+TexturePtr Resource::GetTexture( const StringId& name, const StringId& groupName )
 {
   return ActiveContext->getResourceController()->get<Texture>( name, groupName );
 }
 
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
 
-TextboxPtr Resource::GetTextbox( const string& name, const string& groupName )
+TextboxPtr Resource::GetTextbox( const StringId& name, const StringId& groupName )
 {
   return ActiveContext->getResourceController()->get<Textbox>( name, groupName );
 }
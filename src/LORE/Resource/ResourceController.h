@@ -52,7 +52,8 @@ namespace Lore {
   };
 
   using ResourceIndex = std::multimap<string, IndexedResource>;
-  using ResourceRegistry = Registry<std::unordered_map, IResource>;
+  // Resources may be looked up from any thread while a loader inserts.
+  using ResourceRegistry = SafeRegistry<IResource>;
   using ResourceRegistryMap = std::unordered_map<std::type_index, ResourceRegistry>;
 
   ///
@@ -68,9 +69,13 @@ namespace Lore {
   {
 
     friend class ResourceController;
+    friend class StockResourceController;
 
     string _name {};
     ResourceIndex _index {};
+
+    // Filled for every resource type on construction and never modified
+    // afterwards, so it can be read from any thread without locking.
     ResourceRegistryMap _resources {};
 
     // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
@@ -78,9 +83,14 @@ namespace Lore {
     template<typename T>
     void _addResourceType()
     {
-      _resources[std::type_index( typeid( T ) )] = ResourceRegistry();
+      _resources.emplace( std::piecewise_construct,
+                          std::forward_as_tuple( typeid( T ) ),
+                          std::forward_as_tuple() );
     }
 
+    template<typename T>
+    ResourceRegistry& _getRegistry();
+
   public:
 
     ResourceGroup( const string& name );
@@ -90,13 +100,13 @@ namespace Lore {
     void insertResource( T* resource, const bool autoDuplicate = false );
 
     template<typename T>
-    bool resourceExists( const string& id );
+    bool resourceExists( const StringId& id );
 
     template<typename T>
-    T* getResource( const string& id );
+    T* getResource( const StringId& id );
 
     template<typename T>
-    void removeResource( const string& id );
+    void removeResource( const StringId& id );
 
     //
     // Modifiers.
@@ -112,7 +122,8 @@ namespace Lore {
 
   // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
 
-  using ResourceGroupMap = std::unordered_map<string, std::shared_ptr<ResourceGroup>>; // TODO: Use unique_ptr (shared_ptr for now to avoid very difficult compilation error).
+  // Groups may be created by a loader thread while others look them up.
+  using ResourceGroupMap = SafeRegistry<std::shared_ptr<ResourceGroup>>;
   using PluginCreationFunctor = std::function<IResourcePtr()>;
   using PluginDestructionFunctor = std::function<void( IResourcePtr )>;
   using PluginCreationFunctorMap = std::unordered_map<std::type_index, PluginCreationFunctor>;
@@ -127,6 +138,8 @@ namespace Lore {
   class LORE_EXPORT ResourceController
   {
 
+    friend class StockResourceController;
+
     ResourceGroupMap _groups {};
     ResourceGroupPtr _defaultGroup { nullptr };
 
@@ -136,6 +149,7 @@ namespace Lore {
     // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
 
     ResourceGroupPtr _getGroup( const string& groupName );
+    ResourceGroupPtr _getGroup( const StringId& groupName );
 
   public:
 
@@ -176,11 +190,11 @@ namespace Lore {
 
     // Returns true if specified resource exists.
     template<typename ResourceType>
-    bool resourceExists( const string& name, const string& groupName = DefaultGroupName );
+    bool resourceExists( const StringId& name, const StringId& groupName = DefaultGroupName );
 
     // Returns pointer to specified resource. Throws ItemIdentityException if not found.
     template<typename ResourceType>
-    ResourceType* get( const string& name, const string& groupName = DefaultGroupName );
+    ResourceType* get( const StringId& name, const StringId& groupName = DefaultGroupName );
 
     // Destroys resources that are implemented directly in LORE library.
     template<typename ResourceType>
@@ -333,32 +347,32 @@ namespace Lore {
     //
     // Getters.
 
-    static BoxPtr GetBox( const string& name,
-                          const string& groupName = ResourceController::DefaultGroupName );
-    static PrefabPtr GetPrefab( const string& name,
-                                const string& groupName = ResourceController::DefaultGroupName );
-    static FontPtr GetFont( const string& name,
-                            const string& groupName = ResourceController::DefaultGroupName );
-    static GPUProgramPtr GetGPUProgram( const string& name,
-                                        const string& groupName = ResourceController::DefaultGroupName );
-    static MaterialPtr GetMaterial( const string& name,
-                                    const string& groupName = ResourceController::DefaultGroupName );
-    static MeshPtr GetMesh( const string& name,
-                            const string& groupName = ResourceController::DefaultGroupName );
-    static ModelPtr GetModel( const string& name,
-                              const string& groupName = ResourceController::DefaultGroupName );
-    static RenderTargetPtr GetRenderTarget( const string& name,
-                                            const string& groupName = ResourceController::DefaultGroupName );
-    static ShaderPtr GetShader( const string& name,
-                                const string& groupName = ResourceController::DefaultGroupName );
-    static SpritePtr GetSprite( const string& name,
-                                const string& groupName = ResourceController::DefaultGroupName );
-    static SpriteAnimationSetPtr GetSpriteAnimationSet( const string& name,
-                                                        const string& groupName = ResourceController::DefaultGroupName );
-    static TexturePtr GetTexture( const string& name,
-                                  const string& groupName = ResourceController::DefaultGroupName );
-    static TextboxPtr GetTextbox( const string& name,
-                                  const string& groupName = ResourceController::DefaultGroupName );
+    static BoxPtr GetBox( const StringId& name,
+                          const StringId& groupName = ResourceController::DefaultGroupName );
+    static PrefabPtr GetPrefab( const StringId& name,
+                                const StringId& groupName = ResourceController::DefaultGroupName );
+    static FontPtr GetFont( const StringId& name,
+                            const StringId& groupName = ResourceController::DefaultGroupName );
+    static GPUProgramPtr GetGPUProgram( const StringId& name,
+                                        const StringId& groupName = ResourceController::DefaultGroupName );
+    static MaterialPtr GetMaterial( const StringId& name,
+                                    const StringId& groupName = ResourceController::DefaultGroupName );
+    static MeshPtr GetMesh( const StringId& name,
+                            const StringId& groupName = ResourceController::DefaultGroupName );
+    static ModelPtr GetModel( const StringId& name,
+                              const StringId& groupName = ResourceController::DefaultGroupName );
+    static RenderTargetPtr GetRenderTarget( const StringId& name,
+                                            const StringId& groupName = ResourceController::DefaultGroupName );
+    static ShaderPtr GetShader( const StringId& name,
+                                const StringId& groupName = ResourceController::DefaultGroupName );
+    static SpritePtr GetSprite( const StringId& name,
+                                const StringId& groupName = ResourceController::DefaultGroupName );
+    static SpriteAnimationSetPtr GetSpriteAnimationSet( const StringId& name,
+                                                        const StringId& groupName = ResourceController::DefaultGroupName );
+    static TexturePtr GetTexture( const StringId& name,
+                                  const StringId& groupName = ResourceController::DefaultGroupName );
+    static TextboxPtr GetTextbox( const StringId& name,
+                                  const StringId& groupName = ResourceController::DefaultGroupName );
 
     //
     // Destruction methods.
@@ -25,37 +25,49 @@
 // THE SOFTWARE.
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
 
+template<typename T>
+inline ResourceRegistry& ResourceGroup::_getRegistry()
+{
+  auto lookup = _resources.find( std::type_index( typeid( T ) ) );
+  if ( _resources.end() == lookup ) {
+    throw Lore::Exception( string( "Resource type " ) + typeid( T ).name() + " is not registered in resource groups" );
+  }
+  return lookup->second;
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
 template<typename T>
 inline void ResourceGroup::insertResource( T* resource, const bool autoDuplicate )
 {
-  ResourceRegistry& registry = _resources[std::type_index( typeid( T ) )];
+  ResourceRegistry& registry = _getRegistry<T>();
   registry.insert( resource->getName(), resource, autoDuplicate );
 }
 
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
 
 template<typename T>
-inline bool ResourceGroup::resourceExists( const string& id )
+inline bool ResourceGroup::resourceExists( const StringId& id )
 {
-  ResourceRegistry& registry = _resources[std::type_index( typeid( T ) )];
+  ResourceRegistry& registry = _getRegistry<T>();
   return registry.exists( id );
 }
 
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
 
 template<typename T>
-inline T* ResourceGroup::getResource( const string& id )
+inline T* ResourceGroup::getResource( const StringId& id )
 {
-  ResourceRegistry& registry = _resources[std::type_index( typeid( T ) )];
+  ResourceRegistry& registry = _getRegistry<T>();
   return static_cast< T* >( registry.get( id ) );
 }
 
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
 
 template<typename T>
-inline void ResourceGroup::removeResource( const string& id )
+inline void ResourceGroup::removeResource( const StringId& id )
 {
-  ResourceRegistry& registry = _resources[std::type_index( typeid( T ) )];
+  ResourceRegistry& registry = _getRegistry<T>();
   registry.remove( id );
 }
 
@@ -101,7 +113,7 @@ ResourceController::create( const string& name, const string& groupName, const b
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
 
 template<typename ResourceType>
-inline bool ResourceController::resourceExists( const string& name, const string& groupName )
+inline bool ResourceController::resourceExists( const StringId& name, const StringId& groupName )
 {
   return ( _getGroup( groupName )->resourceExists<ResourceType>( name ) );
 }
@@ -109,7 +121,7 @@ inline bool ResourceController::resourceExists( const string& name, const string
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
 
 template<typename ResourceType>
-inline ResourceType* ResourceController::get( const string& name, const string& groupName )
+inline ResourceType* ResourceController::get( const StringId& name, const StringId& groupName )
 {
   return _getGroup( groupName )->getResource<ResourceType>( name );
 }
@@ -156,10 +168,9 @@ inline void ResourceController::destroyAllInGroup( const string& groupName )
 {
   const std::type_info& ti = typeid( ResourceType );
   LogWrite( Info, "Destroying all resources of type %s in group %s", ti.name(), groupName.c_str() );
-  const auto t = std::type_index( typeid( ResourceType ) );
   auto group = _getGroup( groupName );
-  auto registry = group->_resources[t];
-  auto it = registry.getConstIterator();
+  // Iterate a snapshot, destroy() removes from the live registry.
+  auto it = group->_getRegistry<ResourceType>().getConstIterator();
   while ( it.hasMore() ) {
     destroy<ResourceType>( static_cast< ResourceType* >( it.getNext() ) );
   }
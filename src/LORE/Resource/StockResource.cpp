@@ -120,6 +120,8 @@ void StockResourceController::createStockResources()
     mesh->init( Mesh::Type::Text );
     model->attachMesh( mesh );
   }
+
+  _cacheStockResources();
 }
 
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
@@ -293,34 +295,55 @@ void StockResourceController::createRendererStockResources( const RendererType t
   // Box stock resources.
 
   srf->createBoxProgram( "StandardBox" + suffix );
+
+  _cacheStockResources();
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+void StockResourceController::_cacheStockResources()
+{
+  for ( auto& pair : _controller->_defaultGroup->_resources ) {
+    std::vector<std::pair<StringId, IResource*>> resources;
+    auto it = pair.second.getConstIterator();
+    while ( it.hasMore() ) {
+      resources.emplace_back( it.peekNextKey(), it.peekNextValue() );
+      it.moveNext();
+    }
+
+    auto& cache = _cache[pair.first];
+    cache.clear();
+    cache.insert( resources.begin(), resources.end() );
+  }
 }
 
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
 
-GPUProgramPtr StockResource::GetGPUProgram( const string& name )
+GPUProgramPtr StockResource::GetGPUProgram( const StringId& name )
 {
   return ActiveContext->getStockResourceController()->get<GPUProgram>( name );
 }
 
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
 
-MaterialPtr StockResource::GetMaterial( const string& name )
+MaterialPtr StockResource::GetMaterial( const StringId& name )
 {
   return ActiveContext->getStockResourceController()->get<Material>( name );
 }
 
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
 
-TexturePtr StockResource::GetTexture( const string& name )
+TexturePtr StockResource::GetTexture( const StringId& name )
 {
   return ActiveContext->getStockResourceController()->get<Texture>( name );
 }
 
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
 
-ModelPtr StockResource::GetModel( const string& name )
+ModelPtr StockResource::GetModel( const StringId& name )
 {
   return ActiveContext->getStockResourceController()->get<Model>( name );
 }
@@ -357,7 +380,7 @@ ModelPtr StockResource::GetModel( const Mesh::Type type )
 
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
 
-FontPtr StockResource::GetFont( const string& name )
+FontPtr StockResource::GetFont( const StringId& name )
 {
   return ActiveContext->getStockResourceController()->get<Font>( name );
 }
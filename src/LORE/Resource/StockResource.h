@@ -140,8 +140,12 @@ namespace Lore {
     // Accessor functions.
 
     template<typename ResourceType>
-    ResourceType* get( const string& name )
+    ResourceType* get( const StringId& name )
     {
+      const auto cache = _cache.find( std::type_index( typeid( ResourceType ) ) );
+      if ( _cache.end() != cache && cache->second.exists( name ) ) {
+        return static_cast< ResourceType* >( cache->second.get( name ) );
+      }
       return _controller->get<ResourceType>( name );
     }
 
@@ -149,10 +153,22 @@ namespace Lore {
 
     using StockResourceFactoryMap = std::map<RendererType, std::unique_ptr<StockResourceFactory>>;
 
+    // Stock resources are looked up per draw call. They are all created up
+    // front and never destroyed on their own, so lookups read a plain copy
+    // of them instead of the thread-safe resource registries.
+    using StockResourceCache = std::unordered_map<std::type_index, Registry<FlatMap, IResource>>;
+
     // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
 
     std::unique_ptr<ResourceController> _controller { nullptr };
     StockResourceFactoryMap _factories {};
+    StockResourceCache _cache {};
+
+    // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+    ///
+    /// \brief Copies every resource created so far into the lookup cache.
+    void _cacheStockResources();
 
   };
 
@@ -170,12 +186,12 @@ namespace Lore {
     //
     // Accessor functions.
 
-    static GPUProgramPtr GetGPUProgram( const string& name );
-    static MaterialPtr GetMaterial( const string& name );
-    static TexturePtr GetTexture( const string& name );
-    static ModelPtr GetModel( const string& name );
+    static GPUProgramPtr GetGPUProgram( const StringId& name );
+    static MaterialPtr GetMaterial( const StringId& name );
+    static TexturePtr GetTexture( const StringId& name );
+    static ModelPtr GetModel( const StringId& name );
     static ModelPtr GetModel( const Mesh::Type type );
-    static FontPtr GetFont( const string& name );
+    static FontPtr GetFont( const StringId& name );
 
   };
 
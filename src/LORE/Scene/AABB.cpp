@@ -39,20 +39,31 @@ using namespace Lore;
 AABB::AABB( NodePtr node )
 : _node( node )
 {
-  _box = Lore::Resource::CreateBox( node->_scene->getName() + "." + node->getName() + "_AABB", ResourceController::DefaultGroupName );
 }
 
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
 
 AABB::~AABB()
 {
-  Lore::Resource::DestroyBox( _box );
+  if ( _box ) {
+    Lore::Resource::DestroyBox( _box );
+  }
 }
 
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
 
 void AABB::update()
 {
+  // Prefer the bounds of the node's actual geometry.
+  const BoundingBox& bounds = _node->getWorldBounds();
+  if ( !bounds.isEmpty() ) {
+    _min = bounds.min;
+    _max = bounds.max;
+    _dimensions = _max - _min;
+    return;
+  }
+
+  // Otherwise assume a stock 2D quad.
   const auto x = _node->getWorldPosition().x;
   const auto y = _node->getWorldPosition().y;
   const auto w = _node->getDerivedScale().x * 0.2f;
@@ -81,3 +92,13 @@ bool AABB::intersects( const AABB& rhs ) const
 }
 
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+BoxPtr AABB::getBox()
+{
+  if ( !_box ) {
+    _box = Lore::Resource::CreateBox( _node->_scene->getName() + "." + _node->getName() + "_AABB", ResourceController::DefaultGroupName );
+  }
+  return _box;
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
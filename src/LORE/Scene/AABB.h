@@ -31,7 +31,7 @@ namespace Lore {
   {
 
     NodePtr _node { nullptr };
-    BoxPtr _box { nullptr };
+    BoxPtr _box { nullptr }; // Debug rendering only, created on demand.
     glm::vec3 _min {};
     glm::vec3 _max {};
     glm::vec3 _dimensions {};
@@ -47,11 +47,17 @@ namespace Lore {
     //
     // Getters.
 
-    inline BoxPtr getBox() const
+    inline NodePtr getNode() const
     {
-      return _box;
+      return _node;
     }
 
+    ///
+    /// \brief Returns the box used to draw this AABB for debugging. It is
+    ///     only created on first use, so nodes don't pay for a resource
+    ///     unless AABB rendering is enabled.
+    BoxPtr getBox();
+
     glm::vec3 getMin() const
     {
       return _min;
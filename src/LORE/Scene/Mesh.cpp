@@ -34,6 +34,43 @@ using namespace Lore;
 
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
 
+namespace LocalNS {
+
+  ///
+  /// \brief Fits a box and a sphere around count positions, where
+  ///     getPosition( i ) returns the i-th position.
+  template<typename GetPosition>
+  static void FitBounds( const size_t count,
+                         const GetPosition& getPosition,
+                         BoundingBox& box,
+                         BoundingSphere& sphere )
+  {
+    box = BoundingBox();
+    sphere = BoundingSphere();
+    if ( !count ) {
+      return;
+    }
+
+    for ( size_t i = 0; i < count; ++i ) {
+      box.merge( getPosition( i ) );
+    }
+
+    // Center the sphere on the box, but size it by the farthest vertex,
+    // which is tighter than the box's half diagonal.
+    real radius2 = 0.f;
+    const glm::vec3 center = box.getCenter();
+    for ( size_t i = 0; i < count; ++i ) {
+      radius2 = std::max( radius2, glm::length2( getPosition( i ) - center ) );
+    }
+
+    sphere = BoundingSphere( center, std::sqrt( radius2 ) );
+  }
+
+}
+using namespace LocalNS;
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
 void Mesh::initMaterial()
 {
   if ( !_material ) {
@@ -65,6 +102,37 @@ void Mesh::addAttribute( const AttributeType& type, const uint size )
 
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
 
+void Mesh::computeBounds( const std::vector<real>& vertices,
+                          const size_t stride,
+                          const size_t positionSize )
+{
+  if ( !stride || positionSize < 2 || positionSize > 3 ) {
+    throw Lore::Exception( "Invalid vertex layout for bounds of mesh " + getName() );
+  }
+
+  FitBounds( vertices.size() / stride,
+             [&vertices, stride, positionSize] ( const size_t i ) {
+               const real* v = vertices.data() + i * stride;
+               return glm::vec3( v[0], v[1], ( 3 == positionSize ) ? v[2] : 0.f );
+             },
+             _bounds,
+             _boundingSphere );
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+void Mesh::computeBounds( const std::vector<Vertex>& vertices )
+{
+  FitBounds( vertices.size(),
+             [&vertices] ( const size_t i ) {
+               return vertices[i].position;
+             },
+             _bounds,
+             _boundingSphere );
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
 Mesh::Type Mesh::getType() const
 {
   return _type;
@@ -25,6 +25,7 @@
 // THE SOFTWARE.
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
 
+#include <LORE/Math/Math.h>
 #include <LORE/Memory/Alloc.h>
 #include <LORE/Resource/IResource.h>
 #include <LORE/Resource/Sprite.h>
@@ -106,6 +107,10 @@ namespace Lore {
     Sprite _sprite {};
     MaterialPtr _material {};
 
+    // Local-space bounds, computed from vertex data when the mesh is built.
+    BoundingBox _bounds {};
+    BoundingSphere _boundingSphere {};
+
   public:
 
     Mesh() = default;
@@ -120,9 +125,26 @@ namespace Lore {
 
     void addAttribute( const AttributeType& type, const uint size );
 
+    ///
+    /// \brief Computes the mesh bounds from interleaved vertex data, where
+    ///     each vertex is stride floats beginning with a position of
+    ///     positionSize (2 or 3) components.
+    void computeBounds( const std::vector<real>& vertices,
+                        const size_t stride,
+                        const size_t positionSize );
+
+    ///
+    /// \brief Computes the mesh bounds from custom mesh vertices.
+    void computeBounds( const std::vector<Vertex>& vertices );
+
     virtual void draw( const GPUProgramPtr program, const size_t instanceCount = 0, const bool bindTextures = true, const bool applyMaterial = true ) = 0;
     virtual void draw( const Vertices& verts ) = 0;
 
+    ///
+    /// \brief Draws an instanced mesh with count matrices supplied by the
+    ///     caller. The matrices set with updateInstanced() are left untouched.
+    virtual void drawInstances( const GPUProgramPtr program, const glm::mat4* matrices, const size_t count, const bool bindTextures = true, const bool applyMaterial = true ) = 0;
+
     //
     // Accessors.
 
@@ -130,6 +152,16 @@ namespace Lore {
 
     Type getType() const;
 
+    inline const BoundingBox& getBounds() const
+    {
+      return _bounds;
+    }
+
+    inline const BoundingSphere& getBoundingSphere() const
+    {
+      return _boundingSphere;
+    }
+
   };
 
 }
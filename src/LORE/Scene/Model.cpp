@@ -73,10 +73,22 @@ void Model::draw( const Vertices& verts )
 
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
 
+void Model::drawInstances( const GPUProgramPtr program, const glm::mat4* matrices, const size_t count, const bool bindTextures, const bool applyMaterial )
+{
+  for ( const auto& mesh : _meshes ) {
+    mesh->drawInstances( program, matrices, count, bindTextures, applyMaterial );
+  }
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
 void Model::attachMesh( const MeshPtr mesh )
 {
   _meshes.push_back( mesh );
 
+  _bounds.merge( mesh->getBounds() );
+  _boundingSphere.merge( mesh->getBoundingSphere() );
+
   // Update type based on the attached mesh.
   switch ( mesh->getType() ) {
   case Mesh::Type::Custom:
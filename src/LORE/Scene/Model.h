@@ -45,6 +45,9 @@ namespace Lore {
     Mesh::Type _type { Mesh::Type::Custom };
     MeshList _meshes {};
 
+    BoundingBox _bounds {};
+    BoundingSphere _boundingSphere {};
+
     // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
 
     Model() = default;
@@ -54,6 +57,7 @@ namespace Lore {
 
     void draw( const GPUProgramPtr program, const size_t instanceCount = 0, const bool bindTextures = true, const bool applyMaterial = true );
     void draw( const Vertices& verts );
+    void drawInstances( const GPUProgramPtr program, const glm::mat4* matrices, const size_t count, const bool bindTextures = true, const bool applyMaterial = true );
 
     void attachMesh( const MeshPtr mesh );
 
@@ -64,6 +68,20 @@ namespace Lore {
 
     Mesh::Type getType() const;
 
+    ///
+    /// \brief Returns the local-space box enclosing every attached mesh,
+    ///     which is empty if no mesh has vertex data (such models are
+    ///     never culled).
+    inline const BoundingBox& getBounds() const
+    {
+      return _bounds;
+    }
+
+    inline const BoundingSphere& getBoundingSphere() const
+    {
+      return _boundingSphere;
+    }
+
   };
 
 }
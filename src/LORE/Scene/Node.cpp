@@ -30,6 +30,7 @@
 #include <LORE/Resource/Prefab.h>
 #include <LORE/Resource/ResourceController.h>
 #include <LORE/Resource/Textbox.h>
+#include <LORE/Scene/Model.h>
 
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
 
@@ -46,6 +47,19 @@ Node::Node()
 
 Node::~Node()
 {
+  _invalidateRenderables();
+
+  if ( _transforms ) {
+    _transforms->release( _transformIndex );
+  }
+
+  if ( SpatialIndex::NullProxy != _spatialProxy && _scene && _scene->_spatialIndex ) {
+    _scene->_spatialIndex->remove( _spatialProxy );
+  }
+
+  if ( SpatialHash::NullProxy != _broadPhaseProxy && _scene && _scene->_broadPhase ) {
+    _scene->_broadPhase->remove( _broadPhaseProxy );
+  }
 }
 
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
@@ -56,40 +70,7 @@ NodePtr Node::clone( const string& name, const bool cloneChildNodes )
     throw Lore::Exception( "Cannot clone the root node" );
   }
 
-  auto node = MemoryAccess::GetPrimaryPoolCluster()->create<Node>();
-  node->_name = name;
-  node->_scene = _scene;
-  node->_aabb = std::make_unique<AABB>( node );
-  // TODO: Clone sprite controller...
-  node->_transform = _transform;
-  node->_depth = _depth;
-  node->_prefabs = _prefabs.clone();
-  node->_boxes = _boxes.clone();
-  node->_textboxes = _textboxes.clone();
-  node->_parent = _parent;
-  if ( cloneChildNodes ) {
-    // Clone all child nodes.
-    auto it = _childNodes.getConstIterator();
-    while ( it.hasMore() ) {
-      auto childNode = it.getNext();
-      const string childCloneName = name + "_" + childNode->getName();
-      auto clonedChild = childNode->clone( childCloneName, true );
-      node->_childNodes.insert( childCloneName, clonedChild );
-    }
-  }
-  node->_lights = _lights.clone();
-
-  // Simulate attaching prefabs to this node.
-  auto it = _prefabs.getConstIterator();
-  while ( it.hasMore() ) {
-    auto prefab = it.getNext();
-    prefab->_notifyAttached( node );
-  }
-
-  _parent->_childNodes.insert( name, node );
-  _scene->_nodes.insert( name, node );
-  
-  return node;
+  return _clone( name, _parent, cloneChildNodes );
 }
 
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
@@ -101,6 +82,7 @@ NodePtr Node::createChildNode( const string& name )
   node->_scene = _scene;
   node->_parent = this;
   node->_aabb = std::make_unique<AABB>( node );
+  node->_initTransform( _transforms, _transformIndex );
 
   _scene->_nodes.insert( name, node );
   _childNodes.insert( name, node );
@@ -120,6 +102,8 @@ void Node::attachChildNode( NodePtr node )
   _childNodes.insert( node->getName(), node );
 
   node->_parent = this;
+  _transforms->setParent( node->_transformIndex, _transformIndex );
+  _invalidateRenderables();
 }
 
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
@@ -127,21 +111,28 @@ void Node::attachChildNode( NodePtr node )
 void Node::removeChildNode( NodePtr node )
 {
   _childNodes.remove( node->getName() );
+  _transforms->setParent( node->_transformIndex, TransformHierarchy::Invalid );
   if ( _scene ) {
     _scene->_nodes.remove( node->getName() );
   }
+  _invalidateRenderables();
 }
 
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
 
 void Node::removeAllChildNodes()
 {
+  auto it = _childNodes.getIterator();
+  while ( it.hasMore() ) {
+    _transforms->setParent( it.getNext()->_transformIndex, TransformHierarchy::Invalid );
+  }
   _childNodes.clear();
+  _invalidateRenderables();
 }
 
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
 
-NodePtr Node::getChild( const string& name )
+NodePtr Node::getChild( const StringId& name )
 {
   return _childNodes.get( name );
 }
@@ -173,8 +164,12 @@ void Node::detachFromParent()
 
 void Node::attachObject( PrefabPtr prefab )
 {
-  _prefabs.insert( prefab->getName(), prefab );
+  _prefabs.insert( prefab->getName(), MemoryAccess::GetPrimaryPoolCluster()->getHandle( prefab ) );
   prefab->_notifyAttached( this );
+  _invalidateRenderables();
+
+  // World bounds are refreshed with the transform.
+  _dirty();
 }
 
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
@@ -182,6 +177,7 @@ void Node::attachObject( PrefabPtr prefab )
 void Node::attachObject( LightPtr l )
 {
   _lights.insert( l->getName(), l );
+  _invalidateRenderables();
 }
 
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
@@ -189,6 +185,7 @@ void Node::attachObject( LightPtr l )
 void Node::attachObject( BoxPtr b )
 {
   _boxes.insert( b->getName(), b );
+  _invalidateRenderables();
 }
 
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
@@ -196,6 +193,26 @@ void Node::attachObject( BoxPtr b )
 void Node::attachObject( TextboxPtr t )
 {
   _textboxes.insert( t->getName(), t );
+  _invalidateRenderables();
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+void Node::detachObject( PrefabPtr prefab )
+{
+  if ( !_prefabs.exists( prefab->getName() ) ) {
+    return;
+  }
+
+  _prefabs.remove( prefab->getName() );
+  _invalidateRenderables();
+
+  // Instance slots are never handed back, so collapse this one to nothing.
+  if ( prefab->isInstanced() ) {
+    prefab->updateInstancedMatrix( _instanceID, glm::mat4( 0.f ) );
+  }
+
+  _dirty();
 }
 
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
@@ -216,7 +233,7 @@ void Node::setName( const string& name )
 
 void Node::setPosition( const glm::vec2& position )
 {
-  _transform.position = glm::vec3( position.x, position.y, 0.f );
+  _getTransforms()->position( _transformIndex ) = glm::vec3( position.x, position.y, 0.f );
   _dirty();
 }
 
@@ -232,7 +249,7 @@ void Node::setPosition( const real x, const real y )
 
 void Node::setPosition( const glm::vec3& position )
 {
-  _transform.position = position;
+  _getTransforms()->position( _transformIndex ) = position;
   _dirty();
 }
 
@@ -247,7 +264,7 @@ void Node::setPosition( const real x, const real y, const real z )
 
 void Node::translate( const glm::vec2& offset )
 {
-  _transform.position += glm::vec3( offset.x, offset.y, 0.f );
+  _getTransforms()->position( _transformIndex ) += glm::vec3( offset.x, offset.y, 0.f );
   _dirty();
 }
 
@@ -262,7 +279,7 @@ void Node::translate( const real xOffset, const real yOffset )
 
 void Node::translate( const glm::vec3& offset )
 {
-  _transform.position += offset;
+  _getTransforms()->position( _transformIndex ) += offset;
   _dirty();
 }
 
@@ -277,7 +294,8 @@ void Node::translate( const real xOffset, const real yOffset, const real zOffset
 
 void Node::setOrientation( const glm::quat& orientation, const TransformSpace& ts )
 {
-  _transform.orientation = orientation;
+  _getTransforms()->orientation( _transformIndex ) = orientation;
+  _dirty();
 }
 
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
@@ -308,14 +326,15 @@ void Node::rotate( const glm::vec3& axis, const real angle, const TransformSpace
 void Node::rotate( const glm::quat& q, const TransformSpace& ts )
 {
   glm::quat qnorm = glm::normalize( q );
+  glm::quat& orientation = _getTransforms()->orientation( _transformIndex );
 
   switch ( ts ) {
   case TransformSpace::Local:
-    _transform.orientation = _transform.orientation * qnorm;
+    orientation = orientation * qnorm;
     break;
 
   case TransformSpace::Parent:
-    _transform.orientation = qnorm * _transform.orientation;
+    orientation = qnorm * orientation;
     break;
 
   case TransformSpace::World:
@@ -337,7 +356,7 @@ void Node::setScale( const glm::vec2& scale )
 
 void Node::setScale( const glm::vec3& scale )
 {
-  _transform.scale = scale;
+  _getTransforms()->scale( _transformIndex ) = scale;
   _dirty();
 }
 
@@ -352,7 +371,7 @@ void Node::setScale( const real s )
 
 void Node::scale( const glm::vec2& s )
 {
-  _transform.scale *= glm::vec3( s.x, s.y, 1.f );
+  _getTransforms()->scale( _transformIndex ) *= glm::vec3( s.x, s.y, 1.f );
   _dirty();
 }
 
@@ -360,7 +379,7 @@ void Node::scale( const glm::vec2& s )
 
 void Node::scale( const glm::vec3& s )
 {
-  _transform.scale *= s;
+  _getTransforms()->scale( _transformIndex ) *= s;
   _dirty();
 }
 
@@ -376,8 +395,9 @@ void Node::scale( const real s )
 
 void Node::updateWorldTransform()
 {
-  _transform.derivedScale = _transform.scale;
-  _updateWorldTransform( _getLocalTransform() );
+  // The hierarchy recomputes this node and its subtree on its next update,
+  // taking the parent chain into account.
+  _dirty();
 }
 
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
@@ -433,44 +453,88 @@ glm::mat4 Node::getFlipMatrix() const
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
 
+NodePtr Node::_clone( const string& name, NodePtr parent, const bool cloneChildNodes )
+{
+  auto node = MemoryAccess::GetPrimaryPoolCluster()->create<Node>();
+  node->_name = name;
+  node->_scene = _scene;
+  node->_aabb = std::make_unique<AABB>( node );
+  // TODO: Clone sprite controller...
+  node->_initTransform( _transforms, parent->_transformIndex );
+  _transforms->position( node->_transformIndex ) = getPosition();
+  _transforms->orientation( node->_transformIndex ) = getOrientation();
+  _transforms->scale( node->_transformIndex ) = getScale();
+  _transforms->derivedScale( node->_transformIndex ) = getDerivedScale();
+  node->_depth = _depth;
+  node->_prefabs = _prefabs.clone();
+  node->_boxes = _boxes.clone();
+  node->_textboxes = _textboxes.clone();
+  node->_parent = parent;
+  node->_lights = _lights.clone();
+
+  // Simulate attaching prefabs to this node.
+  auto it = _prefabs.getConstIterator();
+  while ( it.hasMore() ) {
+    auto prefab = MemoryAccess::GetPrimaryPoolCluster()->resolve( it.getNext() );
+    if ( prefab ) {
+      prefab->_notifyAttached( node );
+    }
+  }
+
+  parent->_childNodes.insert( name, node );
+  _scene->_nodes.insert( name, node );
+  _invalidateRenderables();
+
+  if ( cloneChildNodes ) {
+    // Copy the children first, the container must not change while walked.
+    std::vector<NodePtr> children;
+    children.reserve( _childNodes.size() );
+    auto childIt = _childNodes.getConstIterator();
+    while ( childIt.hasMore() ) {
+      children.push_back( childIt.getNext() );
+    }
+
+    // Each clone is inserted under the new node only.
+    for ( const auto& childNode : children ) {
+      childNode->_clone( name + "_" + childNode->getName(), node, true );
+    }
+  }
+
+  return node;
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
 void Node::_dirty()
 {
-  _transform.dirty = true;
+  _getTransforms()->setDirty( _transformIndex );
 }
 
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
 
 bool Node::_transformDirty() const
 {
-  return _transform.dirty;
+  return ( _transforms && _transforms->isDirty( _transformIndex ) );
 }
 
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
 
 glm::mat4 Node::_getLocalTransform()
 {
-  if ( _transform.dirty ) {
-    _transform.local = Math::CreateTransformationMatrix( _transform.position,
-                                                         _transform.orientation,
-                                                         glm::vec3( 1.f ) );
-    _transform.dirty = false;
+  // Dirty stays set, TransformHierarchy::update() only walks dirty slots.
+  if ( _transformDirty() ) {
+    _getTransforms()->local( _transformIndex ) = Math::CreateTransformationMatrix( getPosition(),
+                                                                              getOrientation(),
+                                                                              glm::vec3( 1.f ) );
   }
 
-  return _transform.local;
+  return _getTransforms()->local( _transformIndex );
 }
 
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
 
-void Node::_updateWorldTransform( const glm::mat4& m )
+void Node::_updateLightTransforms()
 {
-  // Apply scaling to final world transform.
-  glm::mat4 s( 1.f );
-  s[0][0] = _transform.derivedScale.x;
-  s[1][1] = _transform.derivedScale.y;
-  s[2][2] = _transform.derivedScale.z;
-
-  _transform.world = m * s;
-
   // Any point light's space transforms for shadows need updating as well.
   auto it = _lights.getIterator();
   while ( it.hasMore() ) {
@@ -483,20 +547,17 @@ void Node::_updateWorldTransform( const glm::mat4& m )
 
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
 
-void Node::_updateChildrenScale()
+void Node::_updateWorldBounds()
 {
-  if ( _parent && _parent->getName() == "root" ) {
-    _transform.derivedScale = _transform.scale;
-  }
+  _worldBounds = BoundingBox();
 
-  auto it = getChildNodeIterator();
+  const glm::mat4 world = getFullTransform();
+  auto it = _prefabs.getConstIterator();
   while ( it.hasMore() ) {
-    auto node = it.getNext();
-    auto scale = node->getScale();
-    node->_transform.derivedScale = _transform.derivedScale * scale;
-
-    // Recurse on all children.
-    node->_updateChildrenScale();
+    PrefabPtr prefab = MemoryAccess::GetPrimaryPoolCluster()->resolve( it.getNext() );
+    if ( prefab ) {
+      _worldBounds.merge( prefab->getModel()->getBounds().transform( world ) );
+    }
   }
 }
 
@@ -506,7 +567,52 @@ void Node::_updateDepthValue()
 {
   // Apply depth to z-value of the model matrix (overwrite SceneGraphVisitor transformations).
   // This is necessary for depth values on nodes to work correctly.
-  _transform.world[3][2] = static_cast< real >( _depth );
+  _getTransforms()->world( _transformIndex )[3][2] = static_cast< real >( _depth );
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+void Node::_initTransform( TransformHierarchy* transforms, const TransformHierarchy::Index parent )
+{
+  // Carry over anything set while the node was outside of a scene.
+  const glm::vec3 position = getPosition();
+  const glm::quat orientation = getOrientation();
+  const glm::vec3 scale = getScale();
+  if ( _transforms ) {
+    _transforms->release( _transformIndex );
+  }
+
+  _transforms = transforms;
+  _transformIndex = _transforms->allocate( this, parent );
+  _transforms->position( _transformIndex ) = position;
+  _transforms->orientation( _transformIndex ) = orientation;
+  _transforms->scale( _transformIndex ) = scale;
+
+  if ( _ownTransforms.get() != transforms ) {
+    _ownTransforms.reset();
+  }
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+TransformHierarchy* Node::_getTransforms()
+{
+  // Nodes created outside of a scene keep their transform in storage of their own.
+  if ( !_transforms ) {
+    _ownTransforms = std::make_unique<TransformHierarchy>();
+    _initTransform( _ownTransforms.get(), TransformHierarchy::Invalid );
+  }
+
+  return _transforms;
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+void Node::_invalidateRenderables()
+{
+  if ( _scene ) {
+    _scene->_renderRegistry.invalidate();
+  }
 }
 
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
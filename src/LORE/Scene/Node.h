@@ -31,39 +31,32 @@
 #include <LORE/Resource/Color.h>
 #include <LORE/Resource/Registry.h>
 #include <LORE/Scene/AABB.h>
+#include <LORE/Scene/RenderRegistry.h>
+#include <LORE/Scene/SpatialHash.h>
+#include <LORE/Scene/SpatialIndex.h>
 #include <LORE/Scene/SpriteController.h>
+#include <LORE/Scene/TransformHierarchy.h>
 
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
 
 namespace Lore {
 
   // TODO: Use a RenderableList for textboxes, textures, boxes, etc?
-  using NodeMap = Registry<std::map, Node>;
+  // Most nodes have a few children and at most one prefab, so these are kept
+  // inline in the node. Rarely used lists only cost an empty FlatMap.
+  using NodeMap = Registry<FlatMap, Node, InlineCapacity<4>>;
   using ChildNodeIterator = NodeMap::Iterator;
   using ConstChildNodeIterator = NodeMap::ConstIterator;
-  using PrefabList = Registry<std::map, Prefab>;
+  using PrefabList = Registry<FlatMap, PrefabHandle, InlineCapacity<1>>;
   using PrefabListConstIterator = PrefabList::ConstIterator;
-  using BoxList = Registry<std::map, Box>;
+  using BoxList = Registry<FlatMap, Box, InlineCapacity<0>>;
   using BoxListConstIterator = BoxList::ConstIterator;
-  using TextboxList = Registry<std::map, Textbox>;
+  using TextboxList = Registry<FlatMap, Textbox, InlineCapacity<0>>;
   using TextboxListConstIterator = TextboxList::ConstIterator;
-  using LightList = Registry<std::map, Light>;
+  using LightList = Registry<FlatMap, Light, InlineCapacity<0>>;
   using LightListConstIterator = LightList::ConstIterator;
   using CameraList = std::vector<CameraPtr>;
 
-  struct Transform
-  {
-    glm::vec3 position { 0.f };
-    glm::quat orientation { 1.f, 0.f, 0.f, 0.f };
-    glm::vec3 scale { 1.f };
-    glm::vec3 derivedScale { 1.f };
-
-    glm::mat4 local { 1.f }; // Local transformation matrix.
-    bool dirty { true }; // True if matrix needs update.
-
-    glm::mat4 world { 1.f }; // Derived transformation in scene graph.
-  };
-
   struct Depth
   {
     static constexpr const real Max = 1000.f;
@@ -82,9 +75,12 @@ namespace Lore {
 
     friend class AABB;
     friend class Prefab;
+    friend class RenderRegistry;
     friend class Scene; // Only scenes can construct nodes.
     friend class SceneGraphVisitor;
+    friend class TransformHierarchy;
     friend class MemoryPool<Node>;
+    friend class NodeTemplate;
 
     // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
 
@@ -95,13 +91,31 @@ namespace Lore {
     std::unique_ptr<AABB> _aabb { nullptr };
     std::unique_ptr<SpriteController> _spriteController { nullptr };
 
-    Transform _transform {};
+    // Transforms live in the scene's dense storage, this is the node's slot.
+    TransformHierarchy* _transforms { nullptr };
+    TransformHierarchy::Index _transformIndex { TransformHierarchy::Invalid };
+    std::unique_ptr<TransformHierarchy> _ownTransforms { nullptr };
 
     real _depth { Depth::Default };
 
     PrefabList _prefabs {};
     size_t _instanceID { 0 };
 
+    // World-space box around all attached prefabs, refreshed whenever the
+    // node's transform is recomputed.
+    BoundingBox _worldBounds {};
+
+    // This node's leaf in the scene's spatial index, if enabled.
+    SpatialIndex::ProxyId _spatialProxy { SpatialIndex::NullProxy };
+
+    // This node's AABB in the scene's 2D broad phase, if enabled.
+    SpatialHash::ProxyId _broadPhaseProxy { SpatialHash::NullProxy };
+
+    // This node's attachments in the scene's render registry, as a range
+    // of entries.
+    uint32_t _renderEntry { 0 };
+    uint32_t _renderEntryCount { 0 };
+
     BoxList _boxes {};
 
     TextboxList _textboxes {};
@@ -125,10 +139,29 @@ namespace Lore {
     void _dirty();
     bool _transformDirty() const;
     glm::mat4 _getLocalTransform();
-    void _updateWorldTransform( const glm::mat4& m );
-    void _updateChildrenScale();
+    void _updateLightTransforms();
+    void _updateWorldBounds();
     void _updateDepthValue();
 
+    ///
+    /// \brief Allocates this node's slot in the scene's transform storage.
+    void _initTransform( TransformHierarchy* transforms, const TransformHierarchy::Index parent );
+
+    ///
+    /// \brief Returns the node's transform storage, allocating storage of its
+    ///     own if the node does not belong to a scene.
+    TransformHierarchy* _getTransforms();
+
+    ///
+    /// \brief Has the scene's render registry rebuilt on the next update,
+    ///     after an attachment or child was added or removed.
+    void _invalidateRenderables();
+
+    ///
+    /// \brief Clones this node under parent, and its children under the
+    ///     clone if cloneChildNodes is true.
+    NodePtr _clone( const string& name, NodePtr parent, const bool cloneChildNodes );
+
   public:
 
     Node();
@@ -139,7 +172,7 @@ namespace Lore {
     void attachChildNode( NodePtr child );
     void removeChildNode( NodePtr child );
     void removeAllChildNodes();
-    NodePtr getChild( const string& name );
+    NodePtr getChild( const StringId& name );
     ChildNodeIterator getChildNodeIterator();
     ConstChildNodeIterator getConstChildNodeIterator();
     void detachFromParent();
@@ -152,6 +185,11 @@ namespace Lore {
     void attachObject( BoxPtr b );
     void attachObject( TextboxPtr t );
 
+    ///
+    /// \brief Stops rendering prefab on this node. An instanced prefab keeps
+    ///     the node's instance slot, which is emptied.
+    void detachObject( PrefabPtr prefab );
+
     inline PrefabListConstIterator getPrefabListConstIterator() const
     {
       return _prefabs.getConstIterator();
@@ -212,8 +250,12 @@ namespace Lore {
       // TODO: Match these values with z-near and z-far in renderer.
       //assert( depth >= -1000.f && depth <= 1000.f ); // Removed for now due to renderer setting depth for UI elements.
       _depth = depth;
+      _dirty();
     }
 
+    ///
+    /// \brief Queues this node's world transform, and its children's, to be
+    ///     recomputed on the next scene graph update.
     void updateWorldTransform();
 
     ///
@@ -233,32 +275,33 @@ namespace Lore {
 
     inline glm::vec3 getPosition() const
     {
-      return _transform.position;
+      return ( _transforms ) ? _transforms->position( _transformIndex ) : glm::vec3( 0.f );
     }
 
     inline glm::vec3 getWorldPosition() const
     {
-      return glm::vec3( _transform.world[3][0], _transform.world[3][1], _transform.world[3][2] );
+      const glm::mat4 world = getFullTransform();
+      return glm::vec3( world[3][0], world[3][1], world[3][2] );
     }
 
     inline glm::quat getOrientation() const
     {
-      return _transform.orientation;
+      return ( _transforms ) ? _transforms->orientation( _transformIndex ) : glm::quat( 1.f, 0.f, 0.f, 0.f );
     }
 
     inline glm::mat4 getFullTransform() const
     {
-      return _transform.world;
+      return ( _transforms ) ? _transforms->world( _transformIndex ) : glm::mat4( 1.f );
     }
 
     inline glm::vec3 getScale() const
     {
-      return _transform.scale;
+      return ( _transforms ) ? _transforms->scale( _transformIndex ) : glm::vec3( 1.f );
     }
 
     inline glm::vec3 getDerivedScale() const
     {
-      return _transform.derivedScale;
+      return ( _transforms ) ? _transforms->derivedScale( _transformIndex ) : glm::vec3( 1.f );
     }
 
     inline bool hasChildNodes() const
@@ -272,6 +315,16 @@ namespace Lore {
     }
 
     AABBPtr getAABB() const;
+
+    ///
+    /// \brief Returns the world-space box around all prefabs attached to this
+    ///     node, as of the last scene graph update. Empty if no attached
+    ///     model has vertex data.
+    inline const BoundingBox& getWorldBounds() const
+    {
+      return _worldBounds;
+    }
+
     SpriteControllerPtr getSpriteController() const;
     glm::mat4 getFlipMatrix() const;
 
@@ -0,0 +1,68 @@
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+// The MIT License (MIT)
+// This source file is part of LORE
+// ( Lightweight Object-oriented Rendering Engine )
+//
+// Copyright (c) 2017-2021 Jordan Sparks
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files ( the "Software" ), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+#include "NodeTemplate.h"
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+using namespace Lore;
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+NodeTemplate::NodeTemplate( const NodePtr root )
+{
+  // Depth-first, so every entry follows its parent.
+  std::vector<std::pair<NodePtr, int32_t>> stack { { root, -1 } };
+  while ( !stack.empty() ) {
+    const NodePtr node = stack.back().first;
+    const int32_t parent = stack.back().second;
+    stack.pop_back();
+
+    const auto index = static_cast< int32_t >( _entries.size() );
+    _entries.emplace_back();
+    Entry& entry = _entries.back();
+    entry.parent = parent;
+    if ( -1 != parent ) {
+      entry.nameSuffix = _entries[parent].nameSuffix + "_" + node->getName();
+    }
+
+    entry.position = node->getPosition();
+    entry.orientation = node->getOrientation();
+    entry.scale = node->getScale();
+    entry.depth = node->getDepth();
+    entry.prefabs = node->_prefabs;
+    entry.boxes = node->_boxes;
+    entry.textboxes = node->_textboxes;
+    entry.lights = node->_lights;
+
+    auto it = node->_childNodes.getConstIterator();
+    while ( it.hasMore() ) {
+      stack.emplace_back( it.getNext(), index );
+    }
+  }
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
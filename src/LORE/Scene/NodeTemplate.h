@@ -0,0 +1,86 @@
+#pragma once
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+// The MIT License (MIT)
+// This source file is part of LORE
+// ( Lightweight Object-oriented Rendering Engine )
+//
+// Copyright (c) 2017-2021 Jordan Sparks
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files ( the "Software" ), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+#include <LORE/Scene/Node.h>
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+namespace Lore {
+
+  ///
+  /// \class NodeTemplate
+  /// \brief An immutable snapshot of a node hierarchy which a scene can
+  ///     instantiate many times in one call, see Scene::instantiate().
+  /// \details The hierarchy is flattened parent-first when the template is
+  ///     compiled, along with each node's local transform, depth, prefabs,
+  ///     boxes, textboxes and lights, so instantiating never walks the source
+  ///     nodes and attachments are copied as whole lists. As with
+  ///     Node::clone(), lights are shared by every instance.
+  class LORE_EXPORT NodeTemplate final
+  {
+
+    friend class Scene;
+
+    struct Entry
+    {
+      // Appended to the instance name, e.g. "_trunk_leaves". Empty for the root.
+      string nameSuffix {};
+      int32_t parent { -1 }; // Index of the parent entry, -1 for the root.
+
+      glm::vec3 position {};
+      glm::quat orientation {};
+      glm::vec3 scale { 1.f };
+      real depth { Depth::Default };
+
+      PrefabList prefabs {};
+      BoxList boxes {};
+      TextboxList textboxes {};
+      LightList lights {};
+    };
+
+    std::vector<Entry> _entries {};
+
+  public:
+
+    ///
+    /// \brief Compiles root and all of its descendants into a template. The
+    ///     source nodes may be changed or destroyed afterwards.
+    explicit NodeTemplate( const NodePtr root );
+    ~NodeTemplate() = default;
+
+    ///
+    /// \brief Number of nodes created per instance.
+    inline size_t size() const
+    {
+      return _entries.size();
+    }
+
+  };
+
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
@@ -0,0 +1,325 @@
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+// The MIT License (MIT)
+// This source file is part of LORE
+// ( Lightweight Object-oriented Rendering Engine )
+//
+// Copyright (c) 2017-2021 Jordan Sparks
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files ( the "Software" ), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+
+#include "RenderRegistry.h"
+
+#include <LORE/Resource/Box.h>
+#include <LORE/Resource/Material.h>
+#include <LORE/Resource/Prefab.h>
+#include <LORE/Resource/Textbox.h>
+#include <LORE/Scene/Light.h>
+#include <LORE/Scene/Node.h>
+#include <LORE/Scene/Scene.h>
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+using namespace Lore;
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+constexpr const uint32_t RenderRegistry::NoInstance;
+
+uint32_t RenderRegistry::Revision = 0;
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+RenderRegistry::RenderRegistry()
+: _queues( DefaultRenderQueueCount )
+{
+  _activeQueues.reserve( DefaultRenderQueueCount );
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+void RenderRegistry::Invalidate()
+{
+  ++Revision;
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+void RenderRegistry::update( const ScenePtr scene )
+{
+  _moved.clear();
+  ++_updateCount;
+
+  if ( _dirty || Revision != _revision ) {
+    _rebuild( scene );
+    _dirty = false;
+    _revision = Revision;
+  }
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+void RenderRegistry::updateTransforms( const NodePtr node )
+{
+  if ( !_hasEntries( node ) ) {
+    return;
+  }
+
+  const glm::mat4 transform = node->getFullTransform();
+
+  const uint32_t end = node->_renderEntry + node->_renderEntryCount;
+  for ( uint32_t i = node->_renderEntry; i < end; ++i ) {
+    const Entry& entry = _entries[i];
+    RenderQueue& queue = _queues[entry.queue];
+
+    switch ( entry.type ) {
+    default:
+      break;
+
+    case Entry::Type::Prefab:
+      if ( entry.prefab->isInstanced() ) {
+        // Every node owns a distinct instance index, so concurrent calls
+        // never write the same element.
+        entry.prefab->updateInstancedMatrix( node->_instanceID, transform );
+      }
+      break;
+
+    case Entry::Type::Box:
+      queue.boxes[entry.slot].model = transform;
+      break;
+
+    case Entry::Type::Textbox:
+      queue.textboxes[entry.slot].model = transform;
+      break;
+
+    case Entry::Type::Light:
+      if ( Light::Type::Point == entry.light->getType() ) {
+        queue.lights.pointLights[entry.slot].second = node->getWorldPosition();
+      }
+      break;
+    }
+  }
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+void RenderRegistry::markMoved( const NodePtr node )
+{
+  if ( !_hasEntries( node ) ) {
+    return;
+  }
+
+  const uint32_t end = node->_renderEntry + node->_renderEntryCount;
+  for ( uint32_t i = node->_renderEntry; i < end; ++i ) {
+    if ( Entry::Type::Prefab == _entries[i].type ) {
+      _moved.push_back( i );
+    }
+  }
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+bool RenderRegistry::setView( const void* owner, const glm::mat4& view )
+{
+  const bool reuse = ( owner == _viewOwner &&
+                       view == _view &&
+                       _viewUpdate + 1 == _updateCount );
+
+  _viewOwner = owner;
+  _view = view;
+  _viewUpdate = _updateCount;
+  return !reuse;
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+void RenderRegistry::_rebuild( const ScenePtr scene )
+{
+  for ( const auto& active : _activeQueues ) {
+    active.second->clear();
+  }
+  _activeQueues.clear();
+  _entries.clear();
+  _instancedSolids.clear();
+
+  _addNode( scene->getRootNode() );
+
+  // Scene-wide directional lights follow those attached to nodes.
+  auto dirLightIt = scene->getDirectionalLights().getConstIterator();
+  while ( dirLightIt.hasMore() ) {
+    _activateQueue( RenderQueue::General ).lights.directionalLights.push_back( dirLightIt.getNext() );
+  }
+
+  // Nothing has been keyed for the new lists.
+  _viewOwner = nullptr;
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+void RenderRegistry::_addNode( const NodePtr node )
+{
+  node->_renderEntry = static_cast< uint32_t >( _entries.size() );
+
+  // Same order as nodes used to be visited in: prefabs, boxes, textboxes,
+  // lights, then each child.
+  auto prefabIt = node->getPrefabListConstIterator();
+  while ( prefabIt.hasMore() ) {
+    // The handle no longer resolves if this prefab has been destroyed, even
+    // if its slot has since been reused.
+    PrefabPtr prefab = MemoryAccess::GetPrimaryPoolCluster()->resolve( prefabIt.getNext() );
+    if ( prefab ) {
+      _addPrefab( node, prefab );
+    }
+  }
+
+  const glm::mat4 transform = node->getFullTransform();
+
+  auto boxIt = node->getBoxListConstIterator();
+  while ( boxIt.hasMore() ) {
+    RenderQueue::BoxList& boxes = _activateQueue( RenderQueue::General ).boxes;
+
+    Entry entry;
+    entry.type = Entry::Type::Box;
+    entry.node = node;
+    entry.box = boxIt.getNext();
+    entry.slot = static_cast< uint32_t >( boxes.size() );
+    boxes.push_back( { entry.box, transform } );
+    _entries.push_back( entry );
+  }
+
+  auto textboxIt = node->getTextboxListConstIterator();
+  while ( textboxIt.hasMore() ) {
+    Entry entry;
+    entry.type = Entry::Type::Textbox;
+    entry.node = node;
+    entry.textbox = textboxIt.getNext();
+    entry.queue = entry.textbox->getRenderQueue();
+
+    RenderQueue::TextboxList& textboxes = _activateQueue( entry.queue ).textboxes;
+    entry.slot = static_cast< uint32_t >( textboxes.size() );
+    textboxes.push_back( { entry.textbox, transform } );
+    _entries.push_back( entry );
+  }
+
+  auto lightIt = node->getLightListConstIterator();
+  while ( lightIt.hasMore() ) {
+    RenderQueue::LightData& lights = _activateQueue( RenderQueue::General ).lights;
+
+    Entry entry;
+    entry.type = Entry::Type::Light;
+    entry.node = node;
+    entry.light = lightIt.getNext();
+
+    switch ( entry.light->getType() ) {
+    default:
+      break;
+
+    case Light::Type::Directional:
+      entry.slot = static_cast< uint32_t >( lights.directionalLights.size() );
+      lights.directionalLights.push_back( static_cast< DirectionalLightPtr >( entry.light ) );
+      break;
+
+    case Light::Type::Point:
+      entry.slot = static_cast< uint32_t >( lights.pointLights.size() );
+      lights.pointLights.emplace_back( static_cast< PointLightPtr >( entry.light ), node->getWorldPosition() );
+      break;
+    }
+    _entries.push_back( entry );
+  }
+
+  node->_renderEntryCount = static_cast< uint32_t >( _entries.size() ) - node->_renderEntry;
+
+  auto childIt = node->getChildNodeIterator();
+  while ( childIt.hasMore() ) {
+    _addNode( childIt.getNext() );
+  }
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+void RenderRegistry::_addPrefab( const NodePtr node, const PrefabPtr prefab )
+{
+  Entry entry;
+  entry.type = Entry::Type::Prefab;
+  entry.node = node;
+  entry.prefab = prefab;
+  entry.queue = prefab->getRenderQueue();
+
+  RenderQueue& queue = _activateQueue( entry.queue );
+
+  if ( prefab->isInstanced() ) {
+    prefab->updateInstancedMatrix( node->_instanceID, node->getFullTransform() );
+  }
+
+  // Blended instanced prefabs are drawn as a whole per node, like any other
+  // draw. Opaque ones are drawn once for all of their nodes.
+  if ( prefab->isInstanced() && !prefab->getMaterial()->blendingMode.enabled ) {
+    auto lookup = _instancedSolids.find( prefab );
+    if ( _instancedSolids.end() == lookup ) {
+      lookup = _instancedSolids.emplace( prefab, static_cast< uint32_t >( queue.instancedSolids.size() ) ).first;
+      queue.instancedSolids.emplace_back();
+      queue.instancedSolids.back().prefab = prefab;
+    }
+
+    RenderQueue::InstancedSolid& solid = queue.instancedSolids[lookup->second];
+    entry.slot = lookup->second;
+    entry.instance = static_cast< uint32_t >( solid.nodes.size() );
+    solid.nodes.push_back( node );
+    solid.visible.push_back( 1 );
+  }
+  else {
+    // Renderers fill in the key.
+    entry.slot = queue.draws.add( 0, prefab, node );
+  }
+
+  _entries.push_back( entry );
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+RenderQueue& RenderRegistry::_activateQueue( const uint32_t id )
+{
+  RenderQueue& rq = _queues.at( id );
+
+  // Keep active queues sorted by id, so they are rendered in order.
+  auto it = std::lower_bound( _activeQueues.begin(), _activeQueues.end(), id,
+                              [] ( const ActiveRenderQueueList::value_type& active, const uint32_t value ) {
+                                return active.first < value;
+                              } );
+  if ( _activeQueues.end() == it || it->first != id ) {
+    _activeQueues.insert( it, { id, &rq } );
+  }
+
+  return rq;
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+bool RenderRegistry::_hasEntries( const NodePtr node ) const
+{
+  // Nodes no longer reachable keep the range of a previous rebuild, which
+  // holds other nodes' entries by now.
+  return node->_renderEntryCount &&
+         node->_renderEntry < _entries.size() &&
+         node == _entries[node->_renderEntry].node;
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
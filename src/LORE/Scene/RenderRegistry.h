@@ -0,0 +1,218 @@
+#pragma once
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+// The MIT License (MIT)
+// This source file is part of LORE
+// ( Lightweight Object-oriented Rendering Engine )
+//
+// Copyright (c) 2017-2021 Jordan Sparks
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files ( the "Software" ), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+#include <LORE/Renderer/RenderQueue.h>
+
+#include <unordered_map>
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+namespace Lore {
+
+  ///
+  /// \class RenderRegistry
+  /// \brief Everything attached to a scene's nodes, kept in render queues
+  ///     that persist between frames.
+  /// \details Attaching, detaching or reparenting only marks the registry
+  ///     dirty, the next scene graph update then rebuilds the queues from
+  ///     the graph in depth-first order, the order the scene graph used to
+  ///     be submitted in. Prefab changes that affect which queue or list a
+  ///     draw belongs in (material, model, render queue, instancing) dirty
+  ///     every registry through Invalidate(). Otherwise frames only refresh
+  ///     the transforms of nodes that moved, and renderers only rekey and
+  ///     recull their draws. Not thread-safe, except where noted.
+  class LORE_EXPORT RenderRegistry final
+  {
+
+  public:
+
+    static constexpr const uint32_t NoInstance = ~uint32_t( 0 );
+
+    struct Entry
+    {
+      enum class Type : uint8_t
+      {
+        Prefab,
+        Box,
+        Textbox,
+        Light
+      };
+
+      Type type { Type::Prefab };
+      NodePtr node { nullptr };
+      union
+      {
+        PrefabPtr prefab;
+        BoxPtr box;
+        TextboxPtr textbox;
+        LightPtr light;
+      };
+
+      // Where the renderable is kept: its queue, then the index of its draw,
+      // instanced solid, box, textbox or light in that queue.
+      uint32_t queue { RenderQueue::General };
+      uint32_t slot { 0 };
+      // The node's index in its instanced solid, if in one.
+      uint32_t instance { NoInstance };
+
+      Entry()
+      : prefab( nullptr )
+      { }
+    };
+
+    using EntryList = std::vector<Entry>;
+    using EntryIndexList = std::vector<uint32_t>;
+
+  private:
+
+    // Bumped by Invalidate(), registries rebuild when theirs is behind.
+    static uint32_t Revision;
+
+    EntryList _entries {};
+
+    RenderQueueList _queues {};
+    ActiveRenderQueueList _activeQueues {};
+
+    // Prefab entries of nodes that moved during the last update.
+    EntryIndexList _moved {};
+
+    // Index of each opaque instanced prefab's InstancedSolid while rebuilding.
+    std::unordered_map<PrefabPtr, uint32_t> _instancedSolids {};
+
+    bool _dirty { true };
+    uint32_t _revision { 0 };
+    uint64_t _updateCount { 0 };
+
+    // The renderer and view the draws were last keyed and culled for.
+    const void* _viewOwner { nullptr };
+    glm::mat4 _view { 1.f };
+    uint64_t _viewUpdate { 0 };
+
+    // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+    void _rebuild( const ScenePtr scene );
+
+    void _addNode( const NodePtr node );
+
+    void _addPrefab( const NodePtr node, const PrefabPtr prefab );
+
+    ///
+    /// \brief Returns the queue with the specified id, adding it to the
+    ///     active queue list if not already there.
+    RenderQueue& _activateQueue( const uint32_t id );
+
+    ///
+    /// \brief Returns true if node's entry range is from the last rebuild,
+    ///     i.e., it was reachable from the root.
+    bool _hasEntries( const NodePtr node ) const;
+
+  public:
+
+    RenderRegistry();
+    ~RenderRegistry() = default;
+
+    ///
+    /// \brief Makes every registry rebuild on its next update. Called when
+    ///     a prefab changes in a way that moves its draws to other lists.
+    static void Invalidate();
+
+    ///
+    /// \brief Makes this registry rebuild on its next update.
+    inline void invalidate()
+    {
+      _dirty = true;
+    }
+
+    ///
+    /// \brief Rebuilds the queues from scene's graph if anything changed,
+    ///     and forgets which nodes moved. World transforms must be current.
+    void update( const ScenePtr scene );
+
+    ///
+    /// \brief Writes node's world transform to its instanced prefabs, boxes,
+    ///     textboxes and point lights. May run concurrently for different
+    ///     nodes.
+    void updateTransforms( const NodePtr node );
+
+    ///
+    /// \brief Records node's prefab draws as moved since the last update.
+    void markMoved( const NodePtr node );
+
+    ///
+    /// \brief Returns true if owner must refresh the key and visibility of
+    ///     every draw for view, false if it only needs to refresh getMoved().
+    /// \details Cached keys can only be reused by the renderer that last
+    ///     computed them, from the same view, if nothing was rebuilt and no
+    ///     update went unseen since.
+    bool setView( const void* owner, const glm::mat4& view );
+
+    //
+    // Getters.
+
+    ///
+    /// \brief Returns the entry at i, in depth-first scene graph order.
+    inline const Entry& operator [] ( const size_t i ) const
+    {
+      return _entries[i];
+    }
+
+    inline size_t size() const
+    {
+      return _entries.size();
+    }
+
+    inline RenderQueue& getQueue( const uint32_t id )
+    {
+      return _queues.at( id );
+    }
+
+    ///
+    /// \brief Returns the queues holding anything, in render order.
+    inline const ActiveRenderQueueList& getActiveQueues() const
+    {
+      return _activeQueues;
+    }
+
+    ///
+    /// \brief Returns the indices of prefab entries whose node moved during
+    ///     the last update.
+    inline const EntryIndexList& getMoved() const
+    {
+      return _moved;
+    }
+
+    //
+    // Deleted functions/operators.
+
+    RenderRegistry( const RenderRegistry& rhs ) = delete;
+    RenderRegistry& operator = ( const RenderRegistry& rhs ) = delete;
+
+  };
+
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
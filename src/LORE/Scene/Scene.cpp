@@ -28,11 +28,12 @@
 
 #include "Scene.h"
 
-#include <LORE/Renderer/SceneGraphVisitor.h>
 #include <LORE/Resource/Material.h>
+#include <LORE/Resource/Prefab.h>
 #include <LORE/Resource/ResourceController.h>
 #include <LORE/Resource/StockResource.h>
 #include <LORE/Scene/AABB.h>
+#include <LORE/Scene/NodeTemplate.h>
 #include <LORE/Scene/SceneLoader.h>
 
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
@@ -45,6 +46,7 @@ Scene::Scene()
 {
   _root._name = "root";
   _root._scene = this;
+  _root._initTransform( &_transforms, TransformHierarchy::Invalid );
 
   // TODO: Get stock skybox
   _skybox = MemoryAccess::GetPrimaryPoolCluster()->create<Skybox>();
@@ -59,11 +61,7 @@ Scene::~Scene()
   _renderer = nullptr;
 
   // Clear all nodes.
-  auto nodeIt = _nodes.getIterator();
-  while ( nodeIt.hasMore() ) {
-    destroyNode( nodeIt.getNext() );
-  }
-  _nodes.clear();
+  clear();
 
   // Clear all lights.
   auto dirLightIt = _directionalLights.getIterator();
@@ -89,6 +87,7 @@ NodePtr Scene::createNode( const string& name )
   node->_name = name;
   node->_scene = this;
   node->_aabb = std::make_unique<AABB>(  node  );
+  node->_initTransform( &_transforms, TransformHierarchy::RootIndex );
 
   _nodes.insert( name, node );
   _root.attachChildNode( node );
@@ -98,6 +97,143 @@ NodePtr Scene::createNode( const string& name )
 
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
 
+std::vector<NodePtr> Scene::createNodes( const size_t count,
+                                         NodePtr parent,
+                                         const string& namePrefix )
+{
+  parent = _resolveParent( parent );
+
+  auto pool = MemoryAccess::GetPrimaryPoolCluster();
+  std::vector<NodePtr> nodes;
+  std::vector<std::pair<ID, NodePtr>> entries;
+  nodes.reserve( count );
+  entries.reserve( count );
+
+  string name = namePrefix;
+  for ( size_t i = 0; i < count; ++i ) {
+    name.resize( namePrefix.size() );
+    name += std::to_string( i );
+
+    auto node = pool->create<Node>();
+    node->_name = name;
+    node->_scene = this;
+    node->_parent = parent;
+    nodes.push_back( node );
+    entries.emplace_back( ID( name ), node );
+  }
+
+  // Registered as one batch, so nothing is kept if any name is taken.
+  try {
+    _insertNodes( entries, entries, parent );
+  }
+  catch ( ... ) {
+    for ( const auto node : nodes ) {
+      pool->destroy<Node>( node );
+    }
+    throw;
+  }
+
+  _transforms.reserve( _transforms.size() + static_cast< uint32_t >( count ) );
+  for ( const auto node : nodes ) {
+    node->_aabb = std::make_unique<AABB>( node );
+    node->_initTransform( &_transforms, parent->_transformIndex );
+  }
+
+  return nodes;
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+std::vector<NodePtr> Scene::instantiate( const NodeTemplate& nodeTemplate,
+                                         const size_t count,
+                                         NodePtr parent,
+                                         const string& namePrefix )
+{
+  parent = _resolveParent( parent );
+
+  const auto& entries = nodeTemplate._entries;
+  const size_t stride = entries.size();
+  const size_t total = count * stride;
+
+  auto pool = MemoryAccess::GetPrimaryPoolCluster();
+  std::vector<NodePtr> nodes;
+  std::vector<std::pair<ID, NodePtr>> ids;
+  std::vector<std::pair<ID, NodePtr>> roots;
+  nodes.reserve( total );
+  ids.reserve( total );
+  roots.reserve( count );
+
+  string name;
+  for ( size_t i = 0; i < count; ++i ) {
+    const size_t base = nodes.size();
+    for ( const auto& entry : entries ) {
+      name.assign( namePrefix );
+      name += std::to_string( i );
+      name += entry.nameSuffix;
+
+      auto node = pool->create<Node>();
+      node->_name = name;
+      node->_scene = this;
+      node->_parent = ( -1 == entry.parent ) ? parent : nodes[base + entry.parent];
+      nodes.push_back( node );
+      ids.emplace_back( ID( name ), node );
+    }
+    roots.push_back( ids[base] );
+  }
+
+  try {
+    _insertNodes( ids, roots, parent );
+  }
+  catch ( ... ) {
+    for ( const auto node : nodes ) {
+      pool->destroy<Node>( node );
+    }
+    throw;
+  }
+
+  // Everything below is copied straight from the template. Nodes are created
+  // parents first, so their transforms stay in parent-before-child order.
+  _transforms.reserve( _transforms.size() + static_cast< uint32_t >( total ) );
+  for ( size_t k = 0; k < total; ++k ) {
+    const auto& entry = entries[k % stride];
+    NodePtr node = nodes[k];
+
+    node->_aabb = std::make_unique<AABB>( node );
+    node->_initTransform( &_transforms, node->_parent->_transformIndex );
+    _transforms.position( node->_transformIndex ) = entry.position;
+    _transforms.orientation( node->_transformIndex ) = entry.orientation;
+    _transforms.scale( node->_transformIndex ) = entry.scale;
+    node->_depth = entry.depth;
+    node->_prefabs = entry.prefabs;
+    node->_boxes = entry.boxes;
+    node->_textboxes = entry.textboxes;
+    node->_lights = entry.lights;
+
+    if ( -1 != entry.parent ) {
+      node->_parent->_childNodes.insert( &ids[k], &ids[k] + 1 );
+    }
+
+    // Take an instancing slot in each prefab.
+    auto it = node->_prefabs.getConstIterator();
+    while ( it.hasMore() ) {
+      auto prefab = pool->resolve( it.getNext() );
+      if ( prefab ) {
+        prefab->_notifyAttached( node );
+      }
+    }
+  }
+  _renderRegistry.invalidate();
+
+  std::vector<NodePtr> result;
+  result.reserve( count );
+  for ( const auto& root : roots ) {
+    result.push_back( root.second );
+  }
+  return result;
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
 void Scene::destroyNode( NodePtr node )
 {
   destroyNode( node->getName() );
@@ -119,7 +255,76 @@ void Scene::destroyNode( const string& name )
 
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
 
-NodePtr Scene::getNode( const string& name )
+void Scene::destroySubtree( NodePtr node )
+{
+  if ( &_root == node ) {
+    clear();
+    return;
+  }
+  if ( this != node->_scene ) {
+    throw Lore::Exception( "Node " + node->getName() + " does not belong to scene " + _name );
+  }
+
+  std::vector<NodePtr> nodes;
+  _collectSubtree( node, nodes );
+
+  if ( node->_parent ) {
+    node->_parent->_childNodes.remove( node->getName() );
+  }
+
+  std::vector<ID> ids;
+  ids.reserve( nodes.size() );
+  for ( const auto n : nodes ) {
+    ids.emplace_back( n->getName() );
+  }
+  _nodes.remove( ids.begin(), ids.end() );
+
+  // Children first, so releasing a transform never orphans a live child.
+  auto pool = MemoryAccess::GetPrimaryPoolCluster();
+  for ( auto it = nodes.rbegin(); it != nodes.rend(); ++it ) {
+    pool->destroy<Node>( *it );
+  }
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+void Scene::clear()
+{
+  std::vector<NodePtr> nodes;
+  auto it = _root._childNodes.getConstIterator();
+  while ( it.hasMore() ) {
+    _collectSubtree( it.getNext(), nodes );
+  }
+
+  _root._childNodes.clear();
+  _nodes.clear();
+
+  // Empty the spatial structures wholesale rather than node by node. The
+  // root stays, so its proxies are rebuilt.
+  _root._spatialProxy = SpatialIndex::NullProxy;
+  _root._broadPhaseProxy = SpatialHash::NullProxy;
+  if ( _spatialIndex ) {
+    _spatialIndex->clear();
+    _updateSpatialIndex( &_root );
+  }
+  if ( _broadPhase ) {
+    _broadPhase->clear();
+    _updateBroadPhase( &_root );
+  }
+
+  _renderRegistry.invalidate();
+
+  auto pool = MemoryAccess::GetPrimaryPoolCluster();
+  for ( auto node = nodes.rbegin(); node != nodes.rend(); ++node ) {
+    ( *node )->_spatialProxy = SpatialIndex::NullProxy;
+    ( *node )->_broadPhaseProxy = SpatialHash::NullProxy;
+    pool->destroy<Node>( *node );
+  }
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+NodePtr Scene::getNode( const StringId& name )
 {
   return _nodes.get( name );
 }
@@ -132,6 +337,7 @@ DirectionalLightPtr Scene::createDirectionalLight( const string& name )
   light->setName( name );
   light->init();
   _directionalLights.insert( name, light );
+  _renderRegistry.invalidate();
 
   return light;
 }
@@ -168,6 +374,7 @@ void Scene::destroyLight( const Light::Type type, const string& name )
     light = _directionalLights.get( name );
     MemoryAccess::GetPrimaryPoolCluster()->destroy<DirectionalLight>( static_cast< DirectionalLightPtr >( light ) );
     _directionalLights.remove( name );
+    _renderRegistry.invalidate();
     break;
 
   case Light::Type::Point:
@@ -207,8 +414,179 @@ void Scene::destroyAllLights()
 void Scene::updateSceneGraph()
 {
   // Traverse the scene graph and update object transforms.
-  Lore::SceneGraphVisitor sgv( getRootNode() );
-  sgv.visit( _renderer );
+  _sceneGraphVisitor.visit();
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+void Scene::setSpatialIndexEnabled( const bool enabled )
+{
+  if ( enabled == !!_spatialIndex ) {
+    return;
+  }
+
+  if ( enabled ) {
+    _spatialIndex = std::make_unique<SpatialIndex>();
+  }
+  else {
+    _spatialIndex.reset();
+  }
+
+  // Index any nodes that already have bounds, or forget their proxies. The
+  // root is not in the node map.
+  _root._spatialProxy = SpatialIndex::NullProxy;
+  if ( enabled ) {
+    _updateSpatialIndex( &_root );
+  }
+
+  auto nodeIt = _nodes.getIterator();
+  while ( nodeIt.hasMore() ) {
+    NodePtr node = nodeIt.getNext();
+    node->_spatialProxy = SpatialIndex::NullProxy;
+    if ( enabled ) {
+      _updateSpatialIndex( node );
+    }
+  }
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+void Scene::setBroadPhaseEnabled( const bool enabled, const real cellSize )
+{
+  if ( enabled ) {
+    _broadPhase = std::make_unique<SpatialHash>( cellSize );
+  }
+  else {
+    _broadPhase.reset();
+  }
+
+  _root._broadPhaseProxy = SpatialHash::NullProxy;
+  if ( enabled ) {
+    _updateBroadPhase( &_root );
+  }
+
+  auto nodeIt = _nodes.getIterator();
+  while ( nodeIt.hasMore() ) {
+    NodePtr node = nodeIt.getNext();
+    node->_broadPhaseProxy = SpatialHash::NullProxy;
+    if ( enabled ) {
+      _updateBroadPhase( node );
+    }
+  }
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+void Scene::queryOverlaps( const AABB& aabb, SpatialHash::NodeList& results ) const
+{
+  if ( !_broadPhase ) {
+    throw Lore::Exception( "Broad phase is not enabled for scene " + _name );
+  }
+
+  const glm::vec3 min = aabb.getMin();
+  const glm::vec3 max = aabb.getMax();
+  _broadPhase->query( glm::vec2( min.x, min.y ), glm::vec2( max.x, max.y ), results, aabb.getNode() );
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+const SpatialHash::PairList& Scene::getOverlappingPairs()
+{
+  if ( !_broadPhase ) {
+    throw Lore::Exception( "Broad phase is not enabled for scene " + _name );
+  }
+
+  return _broadPhase->findPairs();
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+void Scene::_collectSubtree( NodePtr node, std::vector<NodePtr>& nodes )
+{
+  const size_t first = nodes.size();
+  nodes.push_back( node );
+  for ( size_t i = first; i < nodes.size(); ++i ) {
+    auto it = nodes[i]->_childNodes.getConstIterator();
+    while ( it.hasMore() ) {
+      nodes.push_back( it.getNext() );
+    }
+  }
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+NodePtr Scene::_resolveParent( NodePtr parent )
+{
+  if ( !parent ) {
+    return &_root;
+  }
+  if ( this != parent->_scene ) {
+    throw Lore::Exception( "Node " + parent->getName() + " does not belong to scene " + _name );
+  }
+  return parent;
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+void Scene::_insertNodes( const std::vector<std::pair<ID, NodePtr>>& nodes,
+                          const std::vector<std::pair<ID, NodePtr>>& children,
+                          NodePtr parent )
+{
+  _nodes.insert( nodes.begin(), nodes.end() );
+  try {
+    parent->_childNodes.insert( children.begin(), children.end() );
+  }
+  catch ( ... ) {
+    std::vector<ID> ids;
+    ids.reserve( nodes.size() );
+    for ( const auto& entry : nodes ) {
+      ids.push_back( entry.first );
+    }
+    _nodes.remove( ids.begin(), ids.end() );
+    throw;
+  }
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+void Scene::_updateSpatialIndex( NodePtr node )
+{
+  const BoundingBox& bounds = node->getWorldBounds();
+  SpatialIndex::ProxyId& proxy = node->_spatialProxy;
+
+  if ( bounds.isEmpty() ) {
+    if ( SpatialIndex::NullProxy != proxy ) {
+      _spatialIndex->remove( proxy );
+      proxy = SpatialIndex::NullProxy;
+    }
+  }
+  else if ( SpatialIndex::NullProxy == proxy ) {
+    proxy = _spatialIndex->insert( node, bounds );
+  }
+  else {
+    _spatialIndex->update( proxy, bounds );
+  }
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+void Scene::_updateBroadPhase( NodePtr node )
+{
+  if ( !node->_aabb ) {
+    return;
+  }
+
+  const glm::vec3 min = node->_aabb->getMin();
+  const glm::vec3 max = node->_aabb->getMax();
+  SpatialHash::ProxyId& proxy = node->_broadPhaseProxy;
+
+  if ( SpatialHash::NullProxy == proxy ) {
+    proxy = _broadPhase->insert( node, glm::vec2( min.x, min.y ), glm::vec2( max.x, max.y ) );
+  }
+  else {
+    _broadPhase->update( proxy, glm::vec2( min.x, min.y ), glm::vec2( max.x, max.y ) );
+  }
 }
 
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
@@ -26,6 +26,7 @@
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
 
 #include <LORE/Memory/Alloc.h>
+#include <LORE/Renderer/SceneGraphVisitor.h>
 #include <LORE/Resource/Color.h>
 #include <LORE/Resource/Registry.h>
 #include <LORE/Scene/Skybox.h>
@@ -36,7 +37,8 @@
 
 namespace Lore {
 
-  using NodeHashmap = Registry<std::unordered_map, Node>;
+  // Nodes may be looked up from worker threads while the scene is edited.
+  using NodeHashmap = SafeRegistry<Node>;
   using DirectionalLightMap = Registry<std::map, DirectionalLight>;
   using PointLightMap = Registry<std::unordered_map, PointLight>;
   using SpotLightMap = Registry<std::unordered_map, SpotLight>;
@@ -51,6 +53,7 @@ namespace Lore {
   {
 
     friend class Node;
+    friend class SceneGraphVisitor;
 
     LORE_OBJECT_BODY()
 
@@ -59,9 +62,26 @@ namespace Lore {
     // The type of renderer this scene uses.
     RendererPtr _renderer { nullptr };
 
+    // Dense transform storage for every node in this scene, the root included.
+    TransformHierarchy _transforms {};
+
+    // Render queues of everything attached to this scene's nodes. Declared
+    // before the root so it outlives it.
+    RenderRegistry _renderRegistry {};
+
+    // Optional bounding volume tree over nodes with geometry. Declared
+    // before the root, whose destructor removes its proxy.
+    std::unique_ptr<SpatialIndex> _spatialIndex {};
+
+    // Optional 2D grid over node AABBs for overlap queries.
+    std::unique_ptr<SpatialHash> _broadPhase {};
+
     // The scene's root node.
     Node _root {};
 
+    // Walks the graph each frame; kept alive so its scratch lists are reused.
+    SceneGraphVisitor _sceneGraphVisitor { &_root };
+
     // Convenient hash map of all nodes for quick lookup.
     NodeHashmap _nodes {};
 
@@ -82,6 +102,31 @@ namespace Lore {
 
     void _addActiveLight( LightPtr light );
 
+    ///
+    /// \brief Appends node and its descendants to nodes, parents first.
+    static void _collectSubtree( NodePtr node, std::vector<NodePtr>& nodes );
+
+    ///
+    /// \brief Returns parent, or the root if null. Throws if parent belongs
+    ///     to another scene.
+    NodePtr _resolveParent( NodePtr parent );
+
+    ///
+    /// \brief Registers nodes with the scene and children with parent,
+    ///     leaving both unchanged if any id is taken.
+    void _insertNodes( const std::vector<std::pair<ID, NodePtr>>& nodes,
+                       const std::vector<std::pair<ID, NodePtr>>& children,
+                       NodePtr parent );
+
+    ///
+    /// \brief Inserts, refits or removes node in the spatial index to match
+    ///     its current world bounds.
+    void _updateSpatialIndex( NodePtr node );
+
+    ///
+    /// \brief Inserts or moves node's AABB in the broad phase.
+    void _updateBroadPhase( NodePtr node );
+
   public:
 
     Scene();
@@ -90,10 +135,42 @@ namespace Lore {
 
     NodePtr createNode( const string& name );
 
+    ///
+    /// \brief Creates count nodes under parent (the root if null), named
+    ///     namePrefix followed by their index, e.g. "stone0", "stone1"...
+    /// \details Registries are updated once for the whole batch and names are
+    ///     hashed without being interned, so this is much faster than calling
+    ///     createNode() in a loop. Throws, creating nothing, if any name is
+    ///     already taken.
+    std::vector<NodePtr> createNodes( const size_t count,
+                                      NodePtr parent,
+                                      const string& namePrefix );
+
+    ///
+    /// \brief Creates count copies of nodeTemplate under parent (the root if
+    ///     null) and returns their root nodes. Instance roots are named
+    ///     namePrefix followed by their index, and their descendants append
+    ///     the template's names, e.g. "tree0", "tree0_leaves".
+    /// \details Like createNodes(), registries are updated once for the
+    ///     whole batch and nothing is created if any name is taken.
+    std::vector<NodePtr> instantiate( const NodeTemplate& nodeTemplate,
+                                      const size_t count,
+                                      NodePtr parent,
+                                      const string& namePrefix );
+
     void destroyNode( NodePtr node );
     void destroyNode( const string& name );
 
-    NodePtr getNode( const string& name );
+    ///
+    /// \brief Destroys node and all of its descendants, removing them from
+    ///     the scene in a single batch.
+    void destroySubtree( NodePtr node );
+
+    ///
+    /// \brief Destroys every node in the scene except the root.
+    void clear();
+
+    NodePtr getNode( const StringId& name );
 
     DirectionalLightPtr createDirectionalLight( const string& name );
     PointLightPtr createPointLight( const string& name );
@@ -103,9 +180,33 @@ namespace Lore {
     void destroyAllLights();
 
     ///
-    /// \brief Traverses scene graph and updates node transforms based on parent nodes.
+    /// \brief Updates the transforms of nodes moved since the last update,
+    ///     along with their children, and submits the scene to its renderer.
     void updateSceneGraph();
 
+    ///
+    /// \brief Enables or disables the scene's spatial index. While enabled,
+    ///     nodes with geometry are kept in a bounding volume tree which is
+    ///     refit as the scene graph is updated.
+    void setSpatialIndexEnabled( const bool enabled );
+
+    ///
+    /// \brief Enables or disables the scene's 2D broad phase. While enabled,
+    ///     every node's AABB is kept in a spatial hash with cells of cellSize
+    ///     units, refit as the scene graph is updated.
+    void setBroadPhaseEnabled( const bool enabled,
+                               const real cellSize = SpatialHash::DefaultCellSize );
+
+    ///
+    /// \brief Appends every node whose AABB overlaps aabb to results, not
+    ///     including aabb's own node. Requires the broad phase.
+    void queryOverlaps( const AABB& aabb, SpatialHash::NodeList& results ) const;
+
+    ///
+    /// \brief Returns every pair of nodes with overlapping AABBs as of the last
+    ///     scene graph update, in a stable order. Requires the broad phase.
+    const SpatialHash::PairList& getOverlappingPairs();
+
     //
     // Setters.
 
@@ -142,6 +243,32 @@ namespace Lore {
       return &_root;
     }
 
+    ///
+    /// \brief Returns the scene's spatial index, or nullptr if disabled.
+    /// \details The index reflects node bounds as of the last scene graph
+    ///     update.
+    inline SpatialIndex* getSpatialIndex() const
+    {
+      return _spatialIndex.get();
+    }
+
+    ///
+    /// \brief Returns the scene's broad phase, or nullptr if disabled.
+    inline SpatialHash* getBroadPhase() const
+    {
+      return _broadPhase.get();
+    }
+
+    inline RenderRegistry& getRenderRegistry()
+    {
+      return _renderRegistry;
+    }
+
+    inline const RenderRegistry& getRenderRegistry() const
+    {
+      return _renderRegistry;
+    }
+
     inline RendererPtr getRenderer() const
     {
       return _renderer;
@@ -0,0 +1,341 @@
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+// The MIT License (MIT)
+// This source file is part of LORE
+// ( Lightweight Object-oriented Rendering Engine )
+//
+// Copyright (c) 2017-2021 Jordan Sparks
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files ( the "Software" ), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+#include "SpatialHash.h"
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+using namespace Lore;
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+namespace LocalNS {
+
+  // Keeps cell coordinates (and their differences) well within int32_t.
+  static constexpr const real CellLimit = static_cast< real >( 1 << 28 );
+
+  static inline int32_t ToCell( const real v, const real invCellSize )
+  {
+    const real cell = std::floor( v * invCellSize );
+    if ( !( cell > -CellLimit ) ) {
+      return -static_cast< int32_t >( CellLimit );
+    }
+    if ( !( cell < CellLimit ) ) {
+      return static_cast< int32_t >( CellLimit );
+    }
+    return static_cast< int32_t >( cell );
+  }
+
+  static inline uint64_t MakeKey( const int32_t x, const int32_t y )
+  {
+    return ( static_cast< uint64_t >( static_cast< uint32_t >( x ) ) << 32 ) | static_cast< uint32_t >( y );
+  }
+
+  static inline int32_t KeyX( const uint64_t key )
+  {
+    return static_cast< int32_t >( static_cast< uint32_t >( key >> 32 ) );
+  }
+
+  static inline int32_t KeyY( const uint64_t key )
+  {
+    return static_cast< int32_t >( static_cast< uint32_t >( key ) );
+  }
+
+  static inline bool Overlaps( const glm::vec2& minA, const glm::vec2& maxA,
+                               const glm::vec2& minB, const glm::vec2& maxB )
+  {
+    return !( maxA.x < minB.x || maxA.y < minB.y || minA.x > maxB.x || minA.y > maxB.y );
+  }
+
+}
+using namespace LocalNS;
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+SpatialHash::SpatialHash( const real cellSize )
+: _cellSize( cellSize )
+{
+  if ( cellSize <= 0.f ) {
+    throw Lore::Exception( "SpatialHash cell size must be positive" );
+  }
+  _invCellSize = 1.f / cellSize;
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+SpatialHash::ProxyId SpatialHash::insert( const NodePtr node, const glm::vec2& min, const glm::vec2& max )
+{
+  ProxyId id = _freeList;
+  if ( NullProxy != id ) {
+    _freeList = _proxies[id].nextFree;
+  }
+  else {
+    id = static_cast< ProxyId >( _proxies.size() );
+    _proxies.emplace_back();
+  }
+
+  Proxy& proxy = _proxies[id];
+  proxy.node = node;
+  proxy.min = min;
+  proxy.max = max;
+  proxy.nextFree = NullProxy;
+  _addToCells( id );
+
+  ++_proxyCount;
+  _pairsDirty = true;
+  return id;
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+void SpatialHash::remove( const ProxyId proxy )
+{
+  _removeFromCells( proxy );
+  _proxies[proxy] = Proxy {};
+  _proxies[proxy].nextFree = _freeList;
+  _freeList = proxy;
+
+  --_proxyCount;
+  _pairsDirty = true;
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+void SpatialHash::update( const ProxyId proxy, const glm::vec2& min, const glm::vec2& max )
+{
+  Proxy& p = _proxies[proxy];
+  _pairsDirty = true;
+
+  const CellRange cells = _getCellRange( min, max );
+  if ( !p.oversized && cells == p.cells ) {
+    p.min = min;
+    p.max = max;
+    return;
+  }
+
+  _removeFromCells( proxy );
+  p.min = min;
+  p.max = max;
+  _addToCells( proxy );
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+void SpatialHash::clear()
+{
+  _proxies.clear();
+  _freeList = NullProxy;
+  _proxyCount = 0;
+  _cells.clear();
+  _oversized.clear();
+  _pairs.clear();
+  _pairsDirty = false;
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+void SpatialHash::query( const glm::vec2& min,
+                         const glm::vec2& max,
+                         NodeList& results,
+                         const NodePtr exclude ) const
+{
+  const CellRange range = _getCellRange( min, max );
+
+  // A proxy in several cells is only reported from the first cell it shares
+  // with the query, so no de-duplication is needed.
+  auto visitCell = [&] ( const int32_t x, const int32_t y, const std::vector<ProxyId>& ids ) {
+    for ( const auto id : ids ) {
+      const Proxy& p = _proxies[id];
+      if ( x != std::max( range.x0, p.cells.x0 ) || y != std::max( range.y0, p.cells.y0 ) ) {
+        continue;
+      }
+      if ( p.node != exclude && Overlaps( min, max, p.min, p.max ) ) {
+        results.push_back( p.node );
+      }
+    }
+  };
+
+  const int64_t cellCount = ( static_cast< int64_t >( range.x1 ) - range.x0 + 1 ) *
+                            ( static_cast< int64_t >( range.y1 ) - range.y0 + 1 );
+  if ( cellCount > static_cast< int64_t >( _cells.size() ) ) {
+    // Cheaper to walk the occupied cells than the queried ones.
+    for ( const auto& cell : _cells ) {
+      const int32_t x = KeyX( cell.first );
+      const int32_t y = KeyY( cell.first );
+      if ( x >= range.x0 && x <= range.x1 && y >= range.y0 && y <= range.y1 ) {
+        visitCell( x, y, cell.second );
+      }
+    }
+  }
+  else {
+    for ( int32_t y = range.y0; y <= range.y1; ++y ) {
+      for ( int32_t x = range.x0; x <= range.x1; ++x ) {
+        const auto it = _cells.find( MakeKey( x, y ) );
+        if ( _cells.end() != it ) {
+          visitCell( x, y, it->second );
+        }
+      }
+    }
+  }
+
+  for ( const auto id : _oversized ) {
+    const Proxy& p = _proxies[id];
+    if ( p.node != exclude && Overlaps( min, max, p.min, p.max ) ) {
+      results.push_back( p.node );
+    }
+  }
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+const SpatialHash::PairList& SpatialHash::findPairs()
+{
+  if ( !_pairsDirty ) {
+    return _pairs;
+  }
+
+  // Pairs are gathered as (lower id, higher id) keys, sorted, then resolved.
+  _pairKeys.clear();
+  auto addPair = [this] ( const ProxyId a, const ProxyId b ) {
+    const auto lo = static_cast< uint64_t >( std::min( a, b ) );
+    const auto hi = static_cast< uint64_t >( std::max( a, b ) );
+    _pairKeys.push_back( ( lo << 32 ) | hi );
+  };
+
+  for ( const auto& cell : _cells ) {
+    const int32_t x = KeyX( cell.first );
+    const int32_t y = KeyY( cell.first );
+    const auto& ids = cell.second;
+    for ( size_t i = 0; i < ids.size(); ++i ) {
+      const Proxy& a = _proxies[ids[i]];
+      for ( size_t j = i + 1; j < ids.size(); ++j ) {
+        const Proxy& b = _proxies[ids[j]];
+        // Only the first cell two proxies share reports them.
+        if ( x != std::max( a.cells.x0, b.cells.x0 ) || y != std::max( a.cells.y0, b.cells.y0 ) ) {
+          continue;
+        }
+        if ( Overlaps( a.min, a.max, b.min, b.max ) ) {
+          addPair( ids[i], ids[j] );
+        }
+      }
+    }
+  }
+
+  // Oversized proxies are tested against everything, and each other once.
+  for ( const auto id : _oversized ) {
+    const Proxy& a = _proxies[id];
+    for ( ProxyId other = 0; other < static_cast< ProxyId >( _proxies.size() ); ++other ) {
+      const Proxy& b = _proxies[other];
+      if ( other == id || !b.node || ( b.oversized && other < id ) ) {
+        continue;
+      }
+      if ( Overlaps( a.min, a.max, b.min, b.max ) ) {
+        addPair( id, other );
+      }
+    }
+  }
+
+  std::sort( _pairKeys.begin(), _pairKeys.end() );
+
+  _pairs.clear();
+  _pairs.reserve( _pairKeys.size() );
+  for ( const auto key : _pairKeys ) {
+    _pairs.emplace_back( _proxies[static_cast< ProxyId >( key >> 32 )].node,
+                         _proxies[static_cast< ProxyId >( key & 0xFFFFFFFF )].node );
+  }
+
+  _pairsDirty = false;
+  return _pairs;
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+SpatialHash::CellRange SpatialHash::_getCellRange( const glm::vec2& min, const glm::vec2& max ) const
+{
+  CellRange range;
+  range.x0 = ToCell( min.x, _invCellSize );
+  range.y0 = ToCell( min.y, _invCellSize );
+  range.x1 = ToCell( max.x, _invCellSize );
+  range.y1 = ToCell( max.y, _invCellSize );
+  return range;
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+void SpatialHash::_addToCells( const ProxyId id )
+{
+  Proxy& p = _proxies[id];
+  p.cells = _getCellRange( p.min, p.max );
+
+  const int64_t cellCount = ( static_cast< int64_t >( p.cells.x1 ) - p.cells.x0 + 1 ) *
+                            ( static_cast< int64_t >( p.cells.y1 ) - p.cells.y0 + 1 );
+  p.oversized = ( cellCount > MaxCellsPerProxy );
+  if ( p.oversized ) {
+    _oversized.push_back( id );
+    return;
+  }
+
+  for ( int32_t y = p.cells.y0; y <= p.cells.y1; ++y ) {
+    for ( int32_t x = p.cells.x0; x <= p.cells.x1; ++x ) {
+      _cells[MakeKey( x, y )].push_back( id );
+    }
+  }
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+void SpatialHash::_removeFromCells( const ProxyId id )
+{
+  auto erase = [id] ( std::vector<ProxyId>& ids ) {
+    auto it = std::find( ids.begin(), ids.end(), id );
+    if ( ids.end() != it ) {
+      *it = ids.back();
+      ids.pop_back();
+    }
+  };
+
+  const Proxy& p = _proxies[id];
+  if ( p.oversized ) {
+    erase( _oversized );
+    return;
+  }
+
+  for ( int32_t y = p.cells.y0; y <= p.cells.y1; ++y ) {
+    for ( int32_t x = p.cells.x0; x <= p.cells.x1; ++x ) {
+      auto it = _cells.find( MakeKey( x, y ) );
+      if ( _cells.end() != it ) {
+        erase( it->second );
+        // Drop empty cells so a roaming proxy doesn't grow the map forever.
+        if ( it->second.empty() ) {
+          _cells.erase( it );
+        }
+      }
+    }
+  }
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
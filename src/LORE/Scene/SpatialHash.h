@@ -0,0 +1,170 @@
+#pragma once
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+// The MIT License (MIT)
+// This source file is part of LORE
+// ( Lightweight Object-oriented Rendering Engine )
+//
+// Copyright (c) 2017-2021 Jordan Sparks
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files ( the "Software" ), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+#include <LORE/Math/Math.h>
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+namespace Lore {
+
+  ///
+  /// \class SpatialHash
+  /// \brief A uniform grid over the xy plane, used as a broad phase for 2D
+  ///     AABB overlap tests between scene nodes.
+  /// \details Each proxy is filed under every cell its bounds touch, and only
+  ///     proxies sharing a cell are ever tested against each other. Proxies
+  ///     spanning more than MaxCellsPerProxy cells (e.g., backgrounds) are kept
+  ///     in a separate list and tested against everything instead. Overlaps
+  ///     are inclusive, matching AABB::intersects(). Not thread-safe.
+  class LORE_EXPORT SpatialHash final
+  {
+
+  public:
+
+    using ProxyId = int32_t;
+    using NodeList = std::vector<NodePtr>;
+    using Pair = std::pair<NodePtr, NodePtr>;
+    using PairList = std::vector<Pair>;
+
+    static constexpr const ProxyId NullProxy = -1;
+
+  private:
+
+    struct CellRange
+    {
+      int32_t x0 { 0 }, y0 { 0 };
+      int32_t x1 { -1 }, y1 { -1 };
+
+      inline bool operator == ( const CellRange& rhs ) const
+      {
+        return ( x0 == rhs.x0 && y0 == rhs.y0 && x1 == rhs.x1 && y1 == rhs.y1 );
+      }
+    };
+
+    struct Proxy
+    {
+      NodePtr node { nullptr }; // Null while on the free list.
+      glm::vec2 min {};
+      glm::vec2 max {};
+      CellRange cells {};
+      bool oversized { false };
+      ProxyId nextFree { NullProxy };
+    };
+
+    using CellKey = uint64_t;
+    using CellMap = std::unordered_map<CellKey, std::vector<ProxyId>>;
+
+    // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+    std::vector<Proxy> _proxies {};
+    ProxyId _freeList { NullProxy };
+    size_t _proxyCount { 0 };
+
+    CellMap _cells {};
+    std::vector<ProxyId> _oversized {};
+
+    real _cellSize { 0.f };
+    real _invCellSize { 0.f };
+
+    // Pairs are found on demand and cached until a proxy changes.
+    PairList _pairs {};
+    std::vector<uint64_t> _pairKeys {};
+    bool _pairsDirty { false };
+
+    // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+    CellRange _getCellRange( const glm::vec2& min, const glm::vec2& max ) const;
+
+    void _addToCells( const ProxyId id );
+    void _removeFromCells( const ProxyId id );
+
+  public:
+
+    ///
+    /// \brief Default edge length of a grid cell, a little larger than the
+    ///     typical 2D sprite.
+    static constexpr const real DefaultCellSize = 0.5f;
+
+    ///
+    /// \brief Proxies covering more cells than this skip the grid.
+    static constexpr const int64_t MaxCellsPerProxy = 64;
+
+  public:
+
+    explicit SpatialHash( const real cellSize = DefaultCellSize );
+    ~SpatialHash() = default;
+
+    ///
+    /// \brief Adds node with bounds on the xy plane, returns its proxy.
+    ProxyId insert( const NodePtr node, const glm::vec2& min, const glm::vec2& max );
+
+    void remove( const ProxyId proxy );
+
+    ///
+    /// \brief Moves proxy to new bounds. Cells are only touched if the
+    ///     bounds now cover a different set of them.
+    void update( const ProxyId proxy, const glm::vec2& min, const glm::vec2& max );
+
+    void clear();
+
+    ///
+    /// \brief Appends every node whose bounds overlap [min, max] to results,
+    ///     skipping exclude.
+    void query( const glm::vec2& min,
+                const glm::vec2& max,
+                NodeList& results,
+                const NodePtr exclude = nullptr ) const;
+
+    ///
+    /// \brief Returns every pair of overlapping proxies. Each pair appears
+    ///     once, with the earlier inserted proxy first, and the list is
+    ///     ordered by proxy so it is stable from frame to frame.
+    const PairList& findPairs();
+
+    //
+    // Getters.
+
+    inline size_t size() const
+    {
+      return _proxyCount;
+    }
+
+    inline real getCellSize() const
+    {
+      return _cellSize;
+    }
+
+    inline NodePtr getNode( const ProxyId proxy ) const
+    {
+      return _proxies[proxy].node;
+    }
+
+  };
+
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
@@ -0,0 +1,541 @@
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+// The MIT License (MIT)
+// This source file is part of LORE
+// ( Lightweight Object-oriented Rendering Engine )
+//
+// Copyright (c) 2017-2021 Jordan Sparks
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files ( the "Software" ), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+#include "SpatialIndex.h"
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+using namespace Lore;
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+namespace LocalNS {
+
+  // Traversal scratch, reused across queries on the same thread.
+  static thread_local std::vector<SpatialIndex::ProxyId> Stack;
+  static thread_local std::vector<SpatialIndex::ProxyId> CollectStack;
+
+  static inline real SurfaceArea( const BoundingBox& box )
+  {
+    const glm::vec3 e = box.max - box.min;
+    return 2.f * ( e.x * e.y + e.y * e.z + e.z * e.x );
+  }
+
+  static inline BoundingBox Merge( const BoundingBox& a, const BoundingBox& b )
+  {
+    BoundingBox result = a;
+    result.merge( b );
+    return result;
+  }
+
+  static inline bool Contains( const BoundingBox& outer, const BoundingBox& inner )
+  {
+    return ( outer.min.x <= inner.min.x && outer.min.y <= inner.min.y && outer.min.z <= inner.min.z &&
+             outer.max.x >= inner.max.x && outer.max.y >= inner.max.y && outer.max.z >= inner.max.z );
+  }
+
+  ///
+  /// \brief Slab test of a ray against a box, within [0, maxDistance].
+  static bool RayIntersects( const BoundingBox& box,
+                             const glm::vec3& origin,
+                             const glm::vec3& direction,
+                             const real maxDistance )
+  {
+    real tMin = 0.f;
+    real tMax = maxDistance;
+    for ( int i = 0; i < 3; ++i ) {
+      if ( 0.f == direction[i] ) {
+        // Parallel to this slab, so the origin must already be within it.
+        if ( origin[i] < box.min[i] || origin[i] > box.max[i] ) {
+          return false;
+        }
+        continue;
+      }
+
+      const real inv = 1.f / direction[i];
+      real t1 = ( box.min[i] - origin[i] ) * inv;
+      real t2 = ( box.max[i] - origin[i] ) * inv;
+      if ( t1 > t2 ) {
+        std::swap( t1, t2 );
+      }
+
+      tMin = std::max( tMin, t1 );
+      tMax = std::min( tMax, t2 );
+      if ( tMin > tMax ) {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  ///
+  /// \brief Walks the tree, descending into nodes whose fat bounds pass
+  ///     test and appending leaves whose tight bounds pass it.
+  template<typename Tree, typename Test>
+  static void Query( const Tree& nodes,
+                     const SpatialIndex::ProxyId root,
+                     const Test& test,
+                     SpatialIndex::NodeList& results )
+  {
+    if ( SpatialIndex::NullProxy == root ) {
+      return;
+    }
+
+    Stack.clear();
+    Stack.push_back( root );
+    while ( !Stack.empty() ) {
+      const auto& treeNode = nodes[Stack.back()];
+      Stack.pop_back();
+
+      if ( treeNode.isLeaf() ) {
+        if ( test( treeNode.bounds ) ) {
+          results.push_back( treeNode.node );
+        }
+      }
+      else if ( test( treeNode.fatBounds ) ) {
+        Stack.push_back( treeNode.child1 );
+        Stack.push_back( treeNode.child2 );
+      }
+    }
+  }
+
+}
+using namespace LocalNS;
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+SpatialIndex::SpatialIndex( const real margin )
+: _margin( margin )
+{
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+SpatialIndex::ProxyId SpatialIndex::insert( const NodePtr node, const BoundingBox& bounds )
+{
+  const ProxyId proxy = _allocateNode();
+
+  TreeNode& leaf = _nodes[proxy];
+  leaf.node = node;
+  leaf.bounds = bounds;
+  leaf.fatBounds = BoundingBox( bounds.min - glm::vec3( _margin ), bounds.max + glm::vec3( _margin ) );
+  leaf.height = 0;
+
+  _insertLeaf( proxy );
+  ++_proxyCount;
+
+  return proxy;
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+void SpatialIndex::remove( const ProxyId proxy )
+{
+  _removeLeaf( proxy );
+  _freeNode( proxy );
+  --_proxyCount;
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+bool SpatialIndex::update( const ProxyId proxy, const BoundingBox& bounds )
+{
+  TreeNode& leaf = _nodes[proxy];
+  leaf.bounds = bounds;
+  if ( Contains( leaf.fatBounds, bounds ) ) {
+    return false;
+  }
+
+  _removeLeaf( proxy );
+  _nodes[proxy].fatBounds = BoundingBox( bounds.min - glm::vec3( _margin ), bounds.max + glm::vec3( _margin ) );
+  _insertLeaf( proxy );
+
+  return true;
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+void SpatialIndex::clear()
+{
+  _nodes.clear();
+  _root = NullProxy;
+  _freeList = NullProxy;
+  _proxyCount = 0;
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+void SpatialIndex::queryFrustum( const Frustum& frustum, NodeList& results ) const
+{
+  if ( NullProxy == _root ) {
+    return;
+  }
+
+  Stack.clear();
+  Stack.push_back( _root );
+  while ( !Stack.empty() ) {
+    const TreeNode& treeNode = _nodes[Stack.back()];
+    Stack.pop_back();
+
+    if ( treeNode.isLeaf() ) {
+      if ( frustum.intersectsAABB( treeNode.bounds ) ) {
+        results.push_back( treeNode.node );
+      }
+    }
+    else if ( frustum.containsAABB( treeNode.fatBounds ) ) {
+      // Everything below is visible, skip the remaining plane tests.
+      _collect( treeNode.child1, results );
+      _collect( treeNode.child2, results );
+    }
+    else if ( frustum.intersectsAABB( treeNode.fatBounds ) ) {
+      Stack.push_back( treeNode.child1 );
+      Stack.push_back( treeNode.child2 );
+    }
+  }
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+void SpatialIndex::queryAABB( const BoundingBox& box, NodeList& results ) const
+{
+  Query( _nodes, _root, [&box] ( const BoundingBox& bounds ) {
+    return box.intersects( bounds );
+  }, results );
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+void SpatialIndex::querySphere( const BoundingSphere& sphere, NodeList& results ) const
+{
+  Query( _nodes, _root, [&sphere] ( const BoundingBox& bounds ) {
+    return sphere.intersects( bounds );
+  }, results );
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+void SpatialIndex::queryRay( const glm::vec3& origin,
+                             const glm::vec3& direction,
+                             NodeList& results,
+                             const real maxDistance ) const
+{
+  Query( _nodes, _root, [&origin, &direction, maxDistance] ( const BoundingBox& bounds ) {
+    return RayIntersects( bounds, origin, direction, maxDistance );
+  }, results );
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+SpatialIndex::ProxyId SpatialIndex::_allocateNode()
+{
+  if ( NullProxy == _freeList ) {
+    _nodes.emplace_back();
+    return static_cast< ProxyId >( _nodes.size() - 1 );
+  }
+
+  const ProxyId id = _freeList;
+  _freeList = _nodes[id].parent;
+  _nodes[id] = TreeNode();
+  return id;
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+void SpatialIndex::_freeNode( const ProxyId id )
+{
+  TreeNode& treeNode = _nodes[id];
+  treeNode.node = nullptr;
+  treeNode.child1 = treeNode.child2 = NullProxy;
+  treeNode.height = -1;
+  treeNode.parent = _freeList;
+  _freeList = id;
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+void SpatialIndex::_insertLeaf( const ProxyId leaf )
+{
+  if ( NullProxy == _root ) {
+    _root = leaf;
+    _nodes[leaf].parent = NullProxy;
+    return;
+  }
+
+  // Find the best sibling, descending while splitting a child is cheaper
+  // than pairing with the current node.
+  const BoundingBox leafBounds = _nodes[leaf].fatBounds;
+  ProxyId index = _root;
+  while ( !_nodes[index].isLeaf() ) {
+    const TreeNode& current = _nodes[index];
+
+    const real area = SurfaceArea( current.fatBounds );
+    const real combinedArea = SurfaceArea( Merge( current.fatBounds, leafBounds ) );
+
+    // Cost of a new parent for this node and the leaf.
+    const real cost = 2.f * combinedArea;
+
+    // Minimum cost of pushing the leaf further down the tree.
+    const real inheritanceCost = 2.f * ( combinedArea - area );
+
+    auto descendCost = [this, &leafBounds, inheritanceCost] ( const ProxyId child ) {
+      const TreeNode& node = _nodes[child];
+      const real merged = SurfaceArea( Merge( node.fatBounds, leafBounds ) );
+      return ( node.isLeaf() ? merged : merged - SurfaceArea( node.fatBounds ) ) + inheritanceCost;
+    };
+    const real cost1 = descendCost( current.child1 );
+    const real cost2 = descendCost( current.child2 );
+
+    if ( cost < cost1 && cost < cost2 ) {
+      break;
+    }
+
+    index = ( cost1 < cost2 ) ? current.child1 : current.child2;
+  }
+
+  const ProxyId sibling = index;
+
+  // Create a new parent for the sibling and the leaf.
+  const ProxyId oldParent = _nodes[sibling].parent;
+  const ProxyId newParent = _allocateNode();
+  {
+    TreeNode& parent = _nodes[newParent];
+    parent.parent = oldParent;
+    parent.fatBounds = Merge( leafBounds, _nodes[sibling].fatBounds );
+    parent.height = _nodes[sibling].height + 1;
+    parent.child1 = sibling;
+    parent.child2 = leaf;
+  }
+
+  if ( NullProxy != oldParent ) {
+    TreeNode& grandParent = _nodes[oldParent];
+    if ( grandParent.child1 == sibling ) {
+      grandParent.child1 = newParent;
+    }
+    else {
+      grandParent.child2 = newParent;
+    }
+  }
+  else {
+    _root = newParent;
+  }
+  _nodes[sibling].parent = newParent;
+  _nodes[leaf].parent = newParent;
+
+  // Walk back up, rebalancing and refitting ancestors.
+  index = _nodes[leaf].parent;
+  while ( NullProxy != index ) {
+    index = _balance( index );
+
+    TreeNode& node = _nodes[index];
+    const TreeNode& child1 = _nodes[node.child1];
+    const TreeNode& child2 = _nodes[node.child2];
+    node.height = 1 + std::max( child1.height, child2.height );
+    node.fatBounds = Merge( child1.fatBounds, child2.fatBounds );
+
+    index = node.parent;
+  }
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+void SpatialIndex::_removeLeaf( const ProxyId leaf )
+{
+  if ( leaf == _root ) {
+    _root = NullProxy;
+    return;
+  }
+
+  const ProxyId parent = _nodes[leaf].parent;
+  const ProxyId grandParent = _nodes[parent].parent;
+  const ProxyId sibling = ( _nodes[parent].child1 == leaf ) ? _nodes[parent].child2 : _nodes[parent].child1;
+
+  if ( NullProxy == grandParent ) {
+    _root = sibling;
+    _nodes[sibling].parent = NullProxy;
+    _freeNode( parent );
+    return;
+  }
+
+  // Replace the parent with the sibling.
+  if ( _nodes[grandParent].child1 == parent ) {
+    _nodes[grandParent].child1 = sibling;
+  }
+  else {
+    _nodes[grandParent].child2 = sibling;
+  }
+  _nodes[sibling].parent = grandParent;
+  _freeNode( parent );
+
+  ProxyId index = grandParent;
+  while ( NullProxy != index ) {
+    index = _balance( index );
+
+    TreeNode& node = _nodes[index];
+    const TreeNode& child1 = _nodes[node.child1];
+    const TreeNode& child2 = _nodes[node.child2];
+    node.height = 1 + std::max( child1.height, child2.height );
+    node.fatBounds = Merge( child1.fatBounds, child2.fatBounds );
+
+    index = node.parent;
+  }
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+SpatialIndex::ProxyId SpatialIndex::_balance( const ProxyId iA )
+{
+  TreeNode& a = _nodes[iA];
+  if ( a.isLeaf() || a.height < 2 ) {
+    return iA;
+  }
+
+  const ProxyId iB = a.child1;
+  const ProxyId iC = a.child2;
+  TreeNode& b = _nodes[iB];
+  TreeNode& c = _nodes[iC];
+
+  const int32_t balance = c.height - b.height;
+
+  // Rotate c up.
+  if ( balance > 1 ) {
+    const ProxyId iF = c.child1;
+    const ProxyId iG = c.child2;
+    TreeNode& f = _nodes[iF];
+    TreeNode& g = _nodes[iG];
+
+    c.child1 = iA;
+    c.parent = a.parent;
+    a.parent = iC;
+
+    if ( NullProxy != c.parent ) {
+      TreeNode& cParent = _nodes[c.parent];
+      if ( cParent.child1 == iA ) {
+        cParent.child1 = iC;
+      }
+      else {
+        cParent.child2 = iC;
+      }
+    }
+    else {
+      _root = iC;
+    }
+
+    // Keep the taller of c's children under c.
+    if ( f.height > g.height ) {
+      c.child2 = iF;
+      a.child2 = iG;
+      g.parent = iA;
+      a.fatBounds = Merge( b.fatBounds, g.fatBounds );
+      c.fatBounds = Merge( a.fatBounds, f.fatBounds );
+      a.height = 1 + std::max( b.height, g.height );
+      c.height = 1 + std::max( a.height, f.height );
+    }
+    else {
+      c.child2 = iG;
+      a.child2 = iF;
+      f.parent = iA;
+      a.fatBounds = Merge( b.fatBounds, f.fatBounds );
+      c.fatBounds = Merge( a.fatBounds, g.fatBounds );
+      a.height = 1 + std::max( b.height, f.height );
+      c.height = 1 + std::max( a.height, g.height );
+    }
+
+    return iC;
+  }
+
+  // Rotate b up.
+  if ( balance < -1 ) {
+    const ProxyId iD = b.child1;
+    const ProxyId iE = b.child2;
+    TreeNode& d = _nodes[iD];
+    TreeNode& e = _nodes[iE];
+
+    b.child1 = iA;
+    b.parent = a.parent;
+    a.parent = iB;
+
+    if ( NullProxy != b.parent ) {
+      TreeNode& bParent = _nodes[b.parent];
+      if ( bParent.child1 == iA ) {
+        bParent.child1 = iB;
+      }
+      else {
+        bParent.child2 = iB;
+      }
+    }
+    else {
+      _root = iB;
+    }
+
+    // Keep the taller of b's children under b.
+    if ( d.height > e.height ) {
+      b.child2 = iD;
+      a.child1 = iE;
+      e.parent = iA;
+      a.fatBounds = Merge( c.fatBounds, e.fatBounds );
+      b.fatBounds = Merge( a.fatBounds, d.fatBounds );
+      a.height = 1 + std::max( c.height, e.height );
+      b.height = 1 + std::max( a.height, d.height );
+    }
+    else {
+      b.child2 = iE;
+      a.child1 = iD;
+      d.parent = iA;
+      a.fatBounds = Merge( c.fatBounds, d.fatBounds );
+      b.fatBounds = Merge( a.fatBounds, e.fatBounds );
+      a.height = 1 + std::max( c.height, d.height );
+      b.height = 1 + std::max( a.height, e.height );
+    }
+
+    return iB;
+  }
+
+  return iA;
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+void SpatialIndex::_collect( const ProxyId id, NodeList& results ) const
+{
+  CollectStack.clear();
+  CollectStack.push_back( id );
+  while ( !CollectStack.empty() ) {
+    const TreeNode& treeNode = _nodes[CollectStack.back()];
+    CollectStack.pop_back();
+
+    if ( treeNode.isLeaf() ) {
+      results.push_back( treeNode.node );
+    }
+    else {
+      CollectStack.push_back( treeNode.child1 );
+      CollectStack.push_back( treeNode.child2 );
+    }
+  }
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
@@ -0,0 +1,171 @@
+#pragma once
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+// The MIT License (MIT)
+// This source file is part of LORE
+// ( Lightweight Object-oriented Rendering Engine )
+//
+// Copyright (c) 2017-2021 Jordan Sparks
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files ( the "Software" ), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+#include <LORE/Math/Math.h>
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+namespace Lore {
+
+  ///
+  /// \class SpatialIndex
+  /// \brief A dynamic AABB tree over scene nodes, used to answer frustum,
+  ///     box, sphere and ray queries without testing every node.
+  /// \details Leaves store a "fat" box, the node's bounds grown by a margin,
+  ///     so small movements only refit the leaf's tight bounds and leave the
+  ///     tree alone. Inserting picks the sibling with the cheapest surface
+  ///     area increase and the tree is kept balanced with AVL-style
+  ///     rotations. Not thread-safe.
+  class LORE_EXPORT SpatialIndex final
+  {
+
+  public:
+
+    using ProxyId = int32_t;
+    using NodeList = std::vector<NodePtr>;
+
+    static constexpr const ProxyId NullProxy = -1;
+
+  private:
+
+    struct TreeNode
+    {
+      BoundingBox fatBounds {};
+      BoundingBox bounds {}; // Tight bounds, leaves only.
+      NodePtr node { nullptr };
+
+      // Doubles as the next free node while on the free list.
+      ProxyId parent { NullProxy };
+      ProxyId child1 { NullProxy };
+      ProxyId child2 { NullProxy };
+
+      // Leaves are 0, free nodes -1.
+      int32_t height { -1 };
+
+      inline bool isLeaf() const
+      {
+        return ( NullProxy == child1 );
+      }
+    };
+
+    // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+    std::vector<TreeNode> _nodes {};
+    ProxyId _root { NullProxy };
+    ProxyId _freeList { NullProxy };
+    size_t _proxyCount { 0 };
+    real _margin { 0.f };
+
+    // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+    ProxyId _allocateNode();
+    void _freeNode( const ProxyId id );
+
+    void _insertLeaf( const ProxyId leaf );
+    void _removeLeaf( const ProxyId leaf );
+
+    ///
+    /// \brief Rotates the subtree at id if its children's heights differ by
+    ///     more than one, returns the subtree's new root.
+    ProxyId _balance( const ProxyId id );
+
+    ///
+    /// \brief Appends every node below id to results.
+    void _collect( const ProxyId id, NodeList& results ) const;
+
+  public:
+
+    ///
+    /// \brief Default margin added around each leaf's bounds.
+    static constexpr const real DefaultMargin = 0.2f;
+
+  public:
+
+    explicit SpatialIndex( const real margin = DefaultMargin );
+    ~SpatialIndex() = default;
+
+    ///
+    /// \brief Adds node with world-space bounds, returns its proxy.
+    ProxyId insert( const NodePtr node, const BoundingBox& bounds );
+
+    void remove( const ProxyId proxy );
+
+    ///
+    /// \brief Refits proxy to new bounds. The tree is only restructured if
+    ///     the bounds have left the proxy's fat box, in which case true is
+    ///     returned.
+    bool update( const ProxyId proxy, const BoundingBox& bounds );
+
+    void clear();
+
+    //
+    // Queries. Results are appended to the list in no particular order.
+
+    void queryFrustum( const Frustum& frustum, NodeList& results ) const;
+
+    void queryAABB( const BoundingBox& box, NodeList& results ) const;
+
+    void querySphere( const BoundingSphere& sphere, NodeList& results ) const;
+
+    ///
+    /// \brief Finds nodes whose bounds are hit by the ray from origin along
+    ///     direction, within maxDistance (in units of direction's length).
+    void queryRay( const glm::vec3& origin,
+                   const glm::vec3& direction,
+                   NodeList& results,
+                   const real maxDistance = std::numeric_limits<real>::max() ) const;
+
+    //
+    // Getters.
+
+    inline size_t size() const
+    {
+      return _proxyCount;
+    }
+
+    ///
+    /// \brief Returns the height of the tree, 0 for a single leaf.
+    inline int32_t getHeight() const
+    {
+      return ( NullProxy == _root ) ? 0 : _nodes[_root].height;
+    }
+
+    inline NodePtr getNode( const ProxyId proxy ) const
+    {
+      return _nodes[proxy].node;
+    }
+
+    inline const BoundingBox& getBounds( const ProxyId proxy ) const
+    {
+      return _nodes[proxy].bounds;
+    }
+
+  };
+
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
@@ -0,0 +1,419 @@
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+// The MIT License (MIT)
+// This source file is part of LORE
+// ( Lightweight Object-oriented Rendering Engine )
+//
+// Copyright (c) 2017-2021 Jordan Sparks
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files ( the "Software" ), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+#include "TransformHierarchy.h"
+
+#include <LORE/Scene/Node.h>
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+using namespace Lore;
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+// Passed by reference to the vector fill functions, so C++14 needs a
+// definition.
+constexpr const TransformHierarchy::Index TransformHierarchy::Invalid;
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+namespace LocalNS {
+
+  template<typename T>
+  static void Permute( std::vector<T>& v, const std::vector<TransformHierarchy::Index>& order )
+  {
+    std::vector<T> out;
+    out.reserve( order.size() );
+    for ( const auto i : order ) {
+      out.push_back( v[i] );
+    }
+    v.swap( out );
+  }
+
+}
+using namespace LocalNS;
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+TransformHierarchy::~TransformHierarchy()
+{
+  // Nodes outliving their scene must not touch this storage again.
+  for ( const auto node : _nodes ) {
+    if ( node ) {
+      node->_transforms = nullptr;
+      node->_transformIndex = Invalid;
+    }
+  }
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+TransformHierarchy::Index TransformHierarchy::allocate( NodePtr node, const Index parent )
+{
+  const Index i = size();
+
+  _position.emplace_back( 0.f );
+  _orientation.emplace_back( 1.f, 0.f, 0.f, 0.f );
+  _scale.emplace_back( 1.f );
+  _derivedScale.emplace_back( 1.f );
+  _local.emplace_back( 1.f );
+  _combined.emplace_back( 1.f );
+  _world.emplace_back( 1.f );
+  _parent.push_back( Invalid );
+  _firstChild.push_back( Invalid );
+  _nextSibling.push_back( Invalid );
+  _prevSibling.push_back( Invalid );
+  _flags.push_back( Alive );
+  _nodes.push_back( node );
+  _subtreeEnd.push_back( i + 1 );
+
+  if ( Invalid != parent ) {
+    _link( i, parent );
+
+    // Appending under the last subtree keeps every range contiguous, the
+    // parent and all of its ancestors then end at this slot.
+    if ( !_staleLayout && i == _subtreeEnd[parent] ) {
+      for ( Index a = parent; Invalid != a; a = _parent[a] ) {
+        _subtreeEnd[a] = i + 1;
+      }
+    }
+    else {
+      _staleLayout = true;
+    }
+  }
+  setDirty( i );
+
+  return i;
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+void TransformHierarchy::reserve( uint32_t count )
+{
+  // Grow geometrically, so repeated small batches don't reallocate each time.
+  if ( count <= _nodes.capacity() ) {
+    return;
+  }
+  count = std::max( count, static_cast< uint32_t >( _nodes.capacity() * 2 ) );
+
+  _position.reserve( count );
+  _orientation.reserve( count );
+  _scale.reserve( count );
+  _derivedScale.reserve( count );
+  _local.reserve( count );
+  _combined.reserve( count );
+  _world.reserve( count );
+  _parent.reserve( count );
+  _firstChild.reserve( count );
+  _nextSibling.reserve( count );
+  _prevSibling.reserve( count );
+  _flags.reserve( count );
+  _nodes.reserve( count );
+  _subtreeEnd.reserve( count );
+  _dirtyRoots.reserve( count );
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+void TransformHierarchy::release( const Index i )
+{
+  // Orphan the children, the next update marks their subtrees unreachable.
+  Index c = _firstChild[i];
+  while ( Invalid != c ) {
+    const Index next = _nextSibling[c];
+    _parent[c] = Invalid;
+    _nextSibling[c] = _prevSibling[c] = Invalid;
+    setDirty( c );
+    c = next;
+  }
+  _firstChild[i] = Invalid;
+  _unlink( i );
+
+  _flags[i] = 0;
+  _nodes[i] = nullptr;
+  ++_freeCount;
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+void TransformHierarchy::setParent( const Index i, const Index parent )
+{
+  if ( parent == _parent[i] ) {
+    return;
+  }
+
+  _unlink( i );
+  if ( Invalid != parent ) {
+    _link( i, parent );
+  }
+  setDirty( i );
+  _staleLayout = true;
+
+  // A parent placed after its child breaks the parent-before-child ordering.
+  if ( Invalid != parent && parent > i ) {
+    _reorder = true;
+  }
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+void TransformHierarchy::update()
+{
+  // Updating from the root touches every slot anyway, so a stale layout is
+  // rebuilt first rather than walked.
+  const bool fullUpdate = ( size() && ( _flags[RootIndex] & Dirty ) );
+  if ( _reorder || _freeCount * 4 > size() || ( _staleLayout && fullUpdate ) ) {
+    _rebuild();
+  }
+
+  _updated.clear();
+  if ( _dirtyRoots.empty() ) {
+    return;
+  }
+
+  // Parents sit before their children, so after sorting an enclosing root is
+  // walked first and any root nested under it is already clean when reached.
+  std::sort( _dirtyRoots.begin(), _dirtyRoots.end() );
+  for ( const auto i : _dirtyRoots ) {
+    _flags[i] &= ~Queued;
+    if ( ( _flags[i] & ( Alive | Dirty ) ) == ( Alive | Dirty ) ) {
+      if ( _staleLayout ) {
+        _updateSubtree( i );
+      }
+      else {
+        _updateRange( i, _subtreeEnd[i] );
+      }
+    }
+  }
+  _dirtyRoots.clear();
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+void TransformHierarchy::_updateSlot( const Index i )
+{
+  const Index p = _parent[i];
+  uint8_t flags = _flags[i];
+
+  const bool reachable = ( RootIndex == i || ( Invalid != p && ( _flags[p] & Reachable ) ) );
+  if ( reachable ) {
+    if ( flags & Dirty ) {
+      _local[i] = Math::CreateTransformationMatrix( _position[i], _orientation[i], glm::vec3( 1.f ) );
+    }
+
+    if ( RootIndex == i ) {
+      _combined[i] = _local[i];
+    }
+    else {
+      // Scale is not carried in the combined matrices, it is derived
+      // separately and applied last. Children of the root use their own.
+      _derivedScale[i] = ( RootIndex == p ) ? _scale[i] : _derivedScale[p] * _scale[i];
+      _combined[i] = _combined[p] * _local[i];
+    }
+
+    glm::mat4 s( 1.f );
+    s[0][0] = _derivedScale[i].x;
+    s[1][1] = _derivedScale[i].y;
+    s[2][2] = _derivedScale[i].z;
+    _world[i] = _combined[i] * s;
+
+    flags = ( flags & ~Dirty ) | Reachable;
+    _updated.push_back( i );
+  }
+  else {
+    // Detached slots stay dirty until they are attached again.
+    flags &= ~Reachable;
+  }
+  _flags[i] = flags;
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+void TransformHierarchy::_updateRange( const Index begin, const Index end )
+{
+  // Preorder puts every parent before its children within the range. Slots
+  // freed since the last compaction are skipped.
+  for ( Index i = begin; i < end; ++i ) {
+    if ( _flags[i] & Alive ) {
+      _updateSlot( i );
+    }
+  }
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+void TransformHierarchy::_updateSubtree( const Index root )
+{
+  _stack.push_back( root );
+  while ( !_stack.empty() ) {
+    const Index i = _stack.back();
+    _stack.pop_back();
+
+    // The parent is either clean or was recomputed earlier in this walk.
+    _updateSlot( i );
+
+    for ( Index c = _firstChild[i]; Invalid != c; c = _nextSibling[c] ) {
+      _stack.push_back( c );
+    }
+  }
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+void TransformHierarchy::_link( const Index i, const Index parent )
+{
+  const Index first = _firstChild[parent];
+  _parent[i] = parent;
+  _prevSibling[i] = Invalid;
+  _nextSibling[i] = first;
+  if ( Invalid != first ) {
+    _prevSibling[first] = i;
+  }
+  _firstChild[parent] = i;
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+void TransformHierarchy::_unlink( const Index i )
+{
+  const Index p = _parent[i];
+  if ( Invalid == p ) {
+    return;
+  }
+
+  const Index prev = _prevSibling[i];
+  const Index next = _nextSibling[i];
+  if ( Invalid != prev ) {
+    _nextSibling[prev] = next;
+  }
+  else {
+    _firstChild[p] = next;
+  }
+  if ( Invalid != next ) {
+    _prevSibling[next] = prev;
+  }
+
+  _parent[i] = Invalid;
+  _prevSibling[i] = _nextSibling[i] = Invalid;
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+void TransformHierarchy::_rebuild()
+{
+  const Index count = size();
+
+  // Depth-first preorder from the root, followed by any detached subtrees.
+  std::vector<Index> order;
+  order.reserve( count - _freeCount );
+  std::vector<Index> remap( count, Invalid );
+
+  auto walk = [&] ( const Index start ) {
+    _stack.push_back( start );
+    while ( !_stack.empty() ) {
+      const Index i = _stack.back();
+      _stack.pop_back();
+      if ( Invalid != remap[i] ) {
+        continue;
+      }
+      remap[i] = static_cast< Index >( order.size() );
+      order.push_back( i );
+      for ( Index c = _firstChild[i]; Invalid != c; c = _nextSibling[c] ) {
+        _stack.push_back( c );
+      }
+    }
+  };
+
+  for ( Index i = 0; i < count; ++i ) {
+    if ( ( _flags[i] & Alive ) && Invalid == _parent[i] ) {
+      walk( i );
+    }
+  }
+  // Anything left over is part of a parent cycle, which is broken below.
+  for ( Index i = 0; i < count; ++i ) {
+    if ( ( _flags[i] & Alive ) && Invalid == remap[i] ) {
+      walk( i );
+    }
+  }
+
+  std::vector<Index> parents;
+  parents.reserve( order.size() );
+  for ( const auto i : order ) {
+    const Index p = ( Invalid != _parent[i] ) ? remap[_parent[i]] : Invalid;
+    parents.push_back( ( Invalid != p && p < remap[i] ) ? p : Invalid );
+  }
+
+  Permute( _position, order );
+  Permute( _orientation, order );
+  Permute( _scale, order );
+  Permute( _derivedScale, order );
+  Permute( _local, order );
+  Permute( _combined, order );
+  Permute( _world, order );
+  Permute( _flags, order );
+  Permute( _nodes, order );
+
+  // Relink children under their new indices.
+  const Index live = size();
+  _parent.assign( live, Invalid );
+  _firstChild.assign( live, Invalid );
+  _nextSibling.assign( live, Invalid );
+  _prevSibling.assign( live, Invalid );
+  for ( Index i = live; i-- > 0; ) {
+    if ( Invalid != parents[i] ) {
+      _link( i, parents[i] );
+    }
+  }
+
+  std::vector<Index> dirtyRoots;
+  for ( const auto i : _dirtyRoots ) {
+    if ( Invalid != remap[i] ) {
+      dirtyRoots.push_back( remap[i] );
+    }
+  }
+  _dirtyRoots.swap( dirtyRoots );
+
+  for ( Index i = 0; i < live; ++i ) {
+    _nodes[i]->_transformIndex = i;
+  }
+
+  // Every subtree is now contiguous, accumulate sizes from the leaves up.
+  _subtreeEnd.assign( live, 1 );
+  for ( Index i = live; i-- > 0; ) {
+    if ( Invalid != _parent[i] ) {
+      _subtreeEnd[_parent[i]] += _subtreeEnd[i];
+    }
+  }
+  for ( Index i = 0; i < live; ++i ) {
+    _subtreeEnd[i] += i;
+  }
+
+  _freeCount = 0;
+  _reorder = false;
+  _staleLayout = false;
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
@@ -0,0 +1,261 @@
+#pragma once
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+// The MIT License (MIT)
+// This source file is part of LORE
+// ( Lightweight Object-oriented Rendering Engine )
+//
+// Copyright (c) 2017-2021 Jordan Sparks
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files ( the "Software" ), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+#include <LORE/Math/Math.h>
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+namespace Lore {
+
+  ///
+  /// \class TransformHierarchy
+  /// \brief Dense structure-of-arrays storage for every node transform in a
+  ///     scene, kept in parent-before-child order.
+  /// \details Each node owns one slot, addressed by index. Modified slots
+  ///     are queued as dirty roots, and an update only recomputes the
+  ///     subtrees below them, so static branches keep their cached world
+  ///     matrices. Slots are laid out in depth-first preorder, so each
+  ///     subtree is a contiguous range that is updated in one linear sweep.
+  ///     Slots freed by destroyed nodes, and reparenting that breaks the
+  ///     layout, are fixed up lazily by compacting the arrays; until then,
+  ///     subtrees are walked through their child links instead.
+  class LORE_EXPORT TransformHierarchy final
+  {
+
+  public:
+
+    using Index = uint32_t;
+
+    static constexpr const Index Invalid = ~Index( 0 );
+    static constexpr const Index RootIndex = 0;
+
+  private:
+
+    enum Flags : uint8_t
+    {
+      Alive = 1 << 0, // Slot is owned by a node.
+      Dirty = 1 << 1, // Local matrix needs rebuilding.
+      Queued = 1 << 2, // Slot is in the dirty roots list.
+      Reachable = 1 << 3 // Slot is connected to the root.
+    };
+
+    std::vector<glm::vec3> _position {};
+    std::vector<glm::quat> _orientation {};
+    std::vector<glm::vec3> _scale {};
+    std::vector<glm::vec3> _derivedScale {};
+    std::vector<glm::mat4> _local {}; // Translation and rotation only.
+    std::vector<glm::mat4> _combined {}; // Unscaled parent chain, carried down to children.
+    std::vector<glm::mat4> _world {}; // Combined transform with derived scale applied.
+    std::vector<Index> _parent {};
+    std::vector<Index> _firstChild {};
+    std::vector<Index> _nextSibling {};
+    std::vector<Index> _prevSibling {};
+    std::vector<uint8_t> _flags {};
+    std::vector<NodePtr> _nodes {};
+
+    // One past the last slot of each subtree, valid unless _staleLayout.
+    std::vector<Index> _subtreeEnd {};
+
+    // Slots modified since the last update. Their subtrees are recomputed.
+    std::vector<Index> _dirtyRoots {};
+
+    // Slots whose world transform was rebuilt during the last update.
+    std::vector<Index> _updated {};
+
+    // Scratch stack for subtree walks, kept to reuse its allocation.
+    std::vector<Index> _stack {};
+
+    uint32_t _freeCount { 0 };
+    bool _reorder { false };
+
+    // Set when a subtree is no longer a contiguous range of slots.
+    bool _staleLayout { false };
+
+    // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+    ///
+    /// \brief Compacts out dead slots and restores parent-before-child order
+    ///     (depth-first), updating the index held by each node.
+    void _rebuild();
+
+    void _link( const Index i, const Index parent );
+    void _unlink( const Index i );
+
+    ///
+    /// \brief Recomputes the world matrix of slot i, whose parent is clean or
+    ///     has already been recomputed.
+    void _updateSlot( const Index i );
+
+    ///
+    /// \brief Recomputes the world matrices of the slots in [begin, end), a
+    ///     subtree in preorder.
+    void _updateRange( const Index begin, const Index end );
+
+    ///
+    /// \brief Recomputes the world matrices of root and all of its
+    ///     descendants by following child links, for stale layouts.
+    void _updateSubtree( const Index root );
+
+  public:
+
+    TransformHierarchy() = default;
+    ~TransformHierarchy();
+
+    ///
+    /// \brief Appends a slot for node under parent. A parent always exists
+    ///     before its children are created, so appending keeps the ordering.
+    Index allocate( NodePtr node, const Index parent );
+
+    ///
+    /// \brief Reserves room for at least count slots in total.
+    void reserve( uint32_t count );
+
+    ///
+    /// \brief Frees a slot. Children of a released slot become unreachable
+    ///     until they are attached elsewhere.
+    void release( const Index i );
+
+    ///
+    /// \brief Moves slot i under parent (Invalid detaches it from the graph).
+    void setParent( const Index i, const Index parent );
+
+    ///
+    /// \brief Recomputes the world matrices of every dirty root and its
+    ///     descendants. Does nothing if no transform changed.
+    void update();
+
+    //
+    // Per-slot access.
+
+    inline glm::vec3& position( const Index i )
+    {
+      return _position[i];
+    }
+
+    inline glm::quat& orientation( const Index i )
+    {
+      return _orientation[i];
+    }
+
+    inline glm::vec3& scale( const Index i )
+    {
+      return _scale[i];
+    }
+
+    inline glm::vec3& derivedScale( const Index i )
+    {
+      return _derivedScale[i];
+    }
+
+    inline glm::mat4& local( const Index i )
+    {
+      return _local[i];
+    }
+
+    inline glm::mat4& combined( const Index i )
+    {
+      return _combined[i];
+    }
+
+    inline glm::mat4& world( const Index i )
+    {
+      return _world[i];
+    }
+
+    inline const glm::vec3& position( const Index i ) const
+    {
+      return _position[i];
+    }
+
+    inline const glm::quat& orientation( const Index i ) const
+    {
+      return _orientation[i];
+    }
+
+    inline const glm::vec3& scale( const Index i ) const
+    {
+      return _scale[i];
+    }
+
+    inline const glm::vec3& derivedScale( const Index i ) const
+    {
+      return _derivedScale[i];
+    }
+
+    inline const glm::mat4& world( const Index i ) const
+    {
+      return _world[i];
+    }
+
+    inline void setDirty( const Index i )
+    {
+      _flags[i] |= Dirty;
+      if ( !( _flags[i] & Queued ) ) {
+        _flags[i] |= Queued;
+        _dirtyRoots.push_back( i );
+      }
+    }
+
+    inline bool isDirty( const Index i ) const
+    {
+      return ( _flags[i] & Dirty );
+    }
+
+    ///
+    /// \brief True if slot i was connected to the root during the last update.
+    inline bool isReachable( const Index i ) const
+    {
+      return ( _flags[i] & Reachable );
+    }
+
+    inline Index getParent( const Index i ) const
+    {
+      return _parent[i];
+    }
+
+    inline NodePtr getNode( const Index i ) const
+    {
+      return _nodes[i];
+    }
+
+    ///
+    /// \brief Number of slots, including dead ones awaiting compaction.
+    inline uint32_t size() const
+    {
+      return static_cast< uint32_t >( _nodes.size() );
+    }
+
+    inline const std::vector<Index>& getUpdated() const
+    {
+      return _updated;
+    }
+
+  };
+
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
@@ -37,6 +37,38 @@
 
 namespace Lore {
 
+  ///
+  /// \class UniformNameTable
+  /// \brief Builds indexed uniform names such as "pointLights[2].pos" on first
+  ///     use and keeps them, so per-frame uniform updates don't allocate
+  ///     scratch strings.
+  class UniformNameTable final
+  {
+
+    string _prefix {};
+    string _suffix {};
+    std::vector<string> _names {};
+
+  public:
+
+    explicit UniformNameTable( const string& prefix, const string& suffix = "" )
+    : _prefix( prefix )
+    , _suffix( suffix )
+    { }
+
+    inline const string& operator [] ( const size_t idx )
+    {
+      while ( idx >= _names.size() ) {
+        _names.push_back( _prefix + std::to_string( _names.size() ) + _suffix );
+      }
+
+      return _names[idx];
+    }
+
+  };
+
+  // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
   class LORE_EXPORT GPUProgram : public IResource
   {
 
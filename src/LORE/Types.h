@@ -53,6 +53,7 @@ namespace Lore {
   class Mesh;
   class Model;
   class Node;
+  class NodeTemplate;
   class PointLight;
   class PostProcessor;
   class Renderer;
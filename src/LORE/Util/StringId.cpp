@@ -0,0 +1,82 @@
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+// The MIT License (MIT)
+// This source file is part of LORE
+// ( Lightweight Object-oriented Rendering Engine )
+//
+// Copyright (c) 2017-2021 Jordan Sparks
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files ( the "Software" ), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+
+#include "StringId.h"
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+using namespace Lore;
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+namespace LocalNS {
+
+  static std::mutex NameMutex;
+  static std::unordered_map<u64, string> Names;
+
+}
+using namespace LocalNS;
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+StringId StringId::Intern( const string& str )
+{
+  const StringId id( str );
+
+  std::lock_guard<std::mutex> lock( NameMutex );
+  auto result = Names.emplace( id._hash, str );
+  if ( !result.second && !result.first->second.empty() ) {
+    const string& existing = result.first->second;
+    if ( existing.size() != str.size() ||
+         !std::equal( existing.begin(), existing.end(), str.begin(), [] ( const char a, const char b ) {
+           return std::tolower( static_cast< unsigned char >( a ) ) == std::tolower( static_cast< unsigned char >( b ) );
+         } ) ) {
+      LogWrite( Warning, "StringId collision between %s and %s", existing.c_str(), str.c_str() );
+    }
+  }
+
+  return id;
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+string StringId::getName() const
+{
+  {
+    std::lock_guard<std::mutex> lock( NameMutex );
+    auto lookup = Names.find( _hash );
+    if ( Names.end() != lookup ) {
+      return lookup->second;
+    }
+  }
+
+  char buf[24];
+  snprintf( buf, sizeof( buf ), "#%016llx", TO_LLU( _hash ) );
+  return string( buf );
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
@@ -0,0 +1,160 @@
+#pragma once
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+// The MIT License (MIT)
+// This source file is part of LORE
+// ( Lightweight Object-oriented Rendering Engine )
+//
+// Copyright (c) 2017-2021 Jordan Sparks
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files ( the "Software" ), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+namespace Lore {
+
+  ///
+  /// \class StringId
+  /// \brief A case-insensitive identifier stored as a 64-bit hash of its
+  ///     string, so lookups compare integers instead of lowering and hashing
+  ///     strings. Literal ids can be hashed at compile time.
+  /// \details Hashing does not record the string; use Intern() where names
+  ///     are created so getName() can report them in diagnostics. The name
+  ///     table is never pruned, so per-instance names use InternDebug().
+  class LORE_EXPORT StringId final
+  {
+
+    u64 _hash { 0 };
+
+  public:
+
+    static constexpr u64 OffsetBasis = 14695981039346656037ull;
+    static constexpr u64 Prime = 1099511628211ull;
+
+    ///
+    /// \brief FNV-1a hash of the string, folding ASCII to lower case.
+    static constexpr u64 Hash( const char* str, const size_t length )
+    {
+      u64 hash = OffsetBasis;
+      for ( size_t i = 0; i < length; ++i ) {
+        const char c = str[i];
+        hash ^= static_cast< u64 >( static_cast< unsigned char >( ( c >= 'A' && c <= 'Z' ) ? c + ( 'a' - 'A' ) : c ) );
+        hash *= Prime;
+      }
+      return hash;
+    }
+
+    static constexpr u64 Hash( const char* str )
+    {
+      u64 hash = OffsetBasis;
+      for ( ; *str; ++str ) {
+        const char c = *str;
+        hash ^= static_cast< u64 >( static_cast< unsigned char >( ( c >= 'A' && c <= 'Z' ) ? c + ( 'a' - 'A' ) : c ) );
+        hash *= Prime;
+      }
+      return hash;
+    }
+
+    // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+    constexpr StringId() = default;
+
+    constexpr StringId( const char* str )
+    : _hash( Hash( str ) )
+    { }
+
+    constexpr StringId( const char* str, const size_t length )
+    : _hash( Hash( str, length ) )
+    { }
+
+    StringId( const string& str )
+    : _hash( Hash( str.c_str(), str.size() ) )
+    { }
+
+    ///
+    /// \brief Hashes the string and records it in the name table.
+    static StringId Intern( const string& str );
+
+    ///
+    /// \brief Interns the string in debug builds only. Use this for names
+    ///     stored in bulk (e.g. registry keys), which would otherwise grow
+    ///     the name table without bound in release builds.
+    static StringId InternDebug( const string& str )
+    {
+#ifdef NDEBUG
+      return StringId( str );
+#else
+      return Intern( str );
+#endif
+    }
+
+    //
+    // Getters.
+
+    constexpr u64 getHash() const
+    {
+      return _hash;
+    }
+
+    ///
+    /// \brief Returns the interned name of this id (as first interned), or
+    ///     its hash in hex if it was never interned.
+    string getName() const;
+
+    //
+    // Operators.
+
+    constexpr bool operator == ( const StringId& rhs ) const
+    {
+      return ( _hash == rhs._hash );
+    }
+
+    constexpr bool operator != ( const StringId& rhs ) const
+    {
+      return ( _hash != rhs._hash );
+    }
+
+    constexpr bool operator < ( const StringId& rhs ) const
+    {
+      return ( _hash < rhs._hash );
+    }
+
+  };
+
+  ///
+  /// \brief Creates a StringId from a literal at compile time, e.g. "Core"_sid.
+  constexpr StringId operator "" _sid( const char* str, const size_t length )
+  {
+    return StringId( str, length );
+  }
+
+}
+
+namespace std {
+
+  template<>
+  struct hash<Lore::StringId>
+  {
+    size_t operator()( const Lore::StringId& id ) const noexcept
+    {
+      return static_cast< size_t >( id.getHash() );
+    }
+  };
+
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
@@ -171,6 +171,8 @@ void Context::renderFrame( const float lagMultiplier )
 {
   glfwPollEvents();
 
+  _renderAPI->resetStateStats();
+
   Lore::Context::renderFrame( lagMultiplier );
 }
 
@@ -0,0 +1,317 @@
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+// The MIT License (MIT)
+// This source file is part of LORE
+// ( Lightweight Object-oriented Rendering Engine )
+//
+// Copyright (c) 2017-2021 Jordan Sparks
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files ( the "Software" ), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+#include "GLState.h"
+
+#include <array>
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+using namespace Lore::OpenGL;
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+namespace GLStateNS {
+
+  // Never a value the context holds, so comparisons against it always fail.
+  constexpr const GLuint Unknown = ~0u;
+
+  constexpr const size_t MaxTextureUnits = 32;
+  constexpr const size_t TextureTargetCount = 3;
+  constexpr const size_t CapabilityCount = 3;
+
+  struct State
+  {
+    GLuint program { Unknown };
+    GLuint vao { Unknown };
+    GLuint activeUnit { Unknown };
+    std::array<std::array<GLuint, TextureTargetCount>, MaxTextureUnits> textures {};
+
+    std::array<GLuint, CapabilityCount> capabilities {};
+    GLuint cullFace { Unknown };
+    GLuint depthFunc { Unknown };
+    GLuint depthMask { Unknown };
+    std::array<GLenum, 4> blendFunc {};
+    GLuint polygonMode { Unknown };
+    std::array<GLint, 4> viewport {};
+    std::array<Lore::real, 4> clearColor {};
+  };
+
+  static State CreateUnknownState()
+  {
+    State state {};
+    for ( auto& unit : state.textures ) {
+      unit.fill( Unknown );
+    }
+    state.capabilities.fill( Unknown );
+    state.blendFunc.fill( Unknown );
+    state.viewport.fill( -1 );
+    state.clearColor.fill( -1.f );
+    return state;
+  }
+
+  static State Current = CreateUnknownState();
+  static Lore::IRenderAPI::StateStats Stats {};
+
+  // Stores value in the shadow and returns true if the call must be issued.
+  template<typename T>
+  static bool Update( T& shadow, const T& value )
+  {
+    if ( shadow == value ) {
+      ++Stats.skipped;
+      return false;
+    }
+
+    shadow = value;
+    ++Stats.issued;
+    return true;
+  }
+
+  static int GetTextureTargetIndex( const GLenum target )
+  {
+    switch ( target ) {
+    default:
+      return -1;
+
+    case GL_TEXTURE_2D:
+      return 0;
+
+    case GL_TEXTURE_2D_MULTISAMPLE:
+      return 1;
+
+    case GL_TEXTURE_CUBE_MAP:
+      return 2;
+    }
+  }
+
+  static int GetCapabilityIndex( const GLenum cap )
+  {
+    switch ( cap ) {
+    default:
+      return -1;
+
+    case GL_CULL_FACE:
+      return 0;
+
+    case GL_DEPTH_TEST:
+      return 1;
+
+    case GL_BLEND:
+      return 2;
+    }
+  }
+
+}
+using namespace GLStateNS;
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+void GLState::Invalidate()
+{
+  Current = CreateUnknownState();
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+void GLState::ResetStats()
+{
+  Stats = {};
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+const Lore::IRenderAPI::StateStats& GLState::GetStats()
+{
+  return Stats;
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+void GLState::UseProgram( const GLuint program )
+{
+  if ( Update( Current.program, program ) ) {
+    glUseProgram( program );
+  }
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+void GLState::BindVertexArray( const GLuint vao )
+{
+  if ( Update( Current.vao, vao ) ) {
+    glBindVertexArray( vao );
+  }
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+void GLState::DeleteVertexArray( const GLuint vao )
+{
+  // Deleting the bound VAO reverts the binding to zero.
+  if ( Current.vao == vao ) {
+    Current.vao = 0;
+  }
+  glDeleteVertexArrays( 1, &vao );
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+void GLState::ActiveTexture( const GLenum unit )
+{
+  if ( Update( Current.activeUnit, static_cast<GLuint>( unit - GL_TEXTURE0 ) ) ) {
+    glActiveTexture( unit );
+  }
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+void GLState::BindTexture( const GLenum target, const GLuint texture )
+{
+  const int targetIdx = GetTextureTargetIndex( target );
+  if ( -1 == targetIdx || Current.activeUnit >= MaxTextureUnits ) {
+    ++Stats.issued;
+    glBindTexture( target, texture );
+    return;
+  }
+
+  if ( Update( Current.textures[Current.activeUnit][targetIdx], texture ) ) {
+    glBindTexture( target, texture );
+  }
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+void GLState::DeleteTextures( const GLsizei count, const GLuint* textures )
+{
+  // Deleting a bound texture reverts that binding to zero on every unit.
+  for ( GLsizei i = 0; i < count; ++i ) {
+    for ( auto& unit : Current.textures ) {
+      for ( auto& bound : unit ) {
+        if ( bound == textures[i] ) {
+          bound = 0;
+        }
+      }
+    }
+  }
+  glDeleteTextures( count, textures );
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+void GLState::SetEnabled( const GLenum cap, const bool enabled )
+{
+  const int capIdx = GetCapabilityIndex( cap );
+  if ( -1 == capIdx ) {
+    ++Stats.issued;
+  }
+  else if ( !Update( Current.capabilities[capIdx], static_cast<GLuint>( enabled ) ) ) {
+    return;
+  }
+
+  if ( enabled ) {
+    glEnable( cap );
+  }
+  else {
+    glDisable( cap );
+  }
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+void GLState::CullFace( const GLenum mode )
+{
+  if ( Update( Current.cullFace, static_cast<GLuint>( mode ) ) ) {
+    glCullFace( mode );
+  }
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+void GLState::DepthFunc( const GLenum func )
+{
+  if ( Update( Current.depthFunc, static_cast<GLuint>( func ) ) ) {
+    glDepthFunc( func );
+  }
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+void GLState::DepthMask( const bool enabled )
+{
+  if ( Update( Current.depthMask, static_cast<GLuint>( enabled ) ) ) {
+    glDepthMask( ( enabled ) ? GL_TRUE : GL_FALSE );
+  }
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+void GLState::BlendFuncSeparate( const GLenum srcRGB,
+                                 const GLenum dstRGB,
+                                 const GLenum srcAlpha,
+                                 const GLenum dstAlpha )
+{
+  const std::array<GLenum, 4> func { { srcRGB, dstRGB, srcAlpha, dstAlpha } };
+  if ( Update( Current.blendFunc, func ) ) {
+    glBlendFuncSeparate( srcRGB, dstRGB, srcAlpha, dstAlpha );
+  }
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+void GLState::PolygonMode( const GLenum mode )
+{
+  if ( Update( Current.polygonMode, static_cast<GLuint>( mode ) ) ) {
+    glPolygonMode( GL_FRONT_AND_BACK, mode );
+  }
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+void GLState::Viewport( const GLint x,
+                        const GLint y,
+                        const GLsizei width,
+                        const GLsizei height )
+{
+  const std::array<GLint, 4> viewport { { x, y, width, height } };
+  if ( Update( Current.viewport, viewport ) ) {
+    glViewport( x, y, width, height );
+  }
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+void GLState::ClearColor( const real r,
+                          const real g,
+                          const real b,
+                          const real a )
+{
+  const std::array<real, 4> color { { r, g, b, a } };
+  if ( Update( Current.clearColor, color ) ) {
+    glClearColor( r, g, b, a );
+  }
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
@@ -0,0 +1,115 @@
+#pragma once
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+// The MIT License (MIT)
+// This source file is part of LORE
+// ( Lightweight Object-oriented Rendering Engine )
+//
+// Copyright (c) 2017-2021 Jordan Sparks
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files ( the "Software" ), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+#include <LORE/Renderer/IRenderAPI.h>
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+namespace Lore { namespace OpenGL {
+
+  ///
+  /// \class GLState
+  /// \brief Shadow copy of the current context's bindings and fixed-function
+  ///     state. Calls that would set a value the context already holds are
+  ///     dropped before they reach the driver.
+  /// All plugin code must change the state tracked here through GLState,
+  /// otherwise the shadow goes stale. Invalidate() must be called whenever
+  /// a different context is made current.
+  class GLState
+  {
+
+  public:
+
+    ///
+    /// \brief Forgets all shadowed values, so the next call of each kind
+    ///     is always issued.
+    static void Invalidate();
+
+    ///
+    /// \brief Zeroes the issued/skipped counters, called once per frame.
+    static void ResetStats();
+
+    static const IRenderAPI::StateStats& GetStats();
+
+    //
+    // Bindings.
+
+    static void UseProgram( const GLuint program );
+
+    static void BindVertexArray( const GLuint vao );
+
+    static void DeleteVertexArray( const GLuint vao );
+
+    ///
+    /// \brief Takes the GL enum (GL_TEXTURE0 + n), like glActiveTexture.
+    static void ActiveTexture( const GLenum unit );
+
+    ///
+    /// \brief Binds to the active texture unit. Only 2D, multisampled 2D and
+    ///     cubemap targets are shadowed, others are always issued.
+    static void BindTexture( const GLenum target, const GLuint texture );
+
+    static void DeleteTextures( const GLsizei count, const GLuint* textures );
+
+    //
+    // Fixed-function state.
+
+    ///
+    /// \brief Shadows GL_CULL_FACE, GL_DEPTH_TEST and GL_BLEND, other
+    ///     capabilities are always issued.
+    static void SetEnabled( const GLenum cap, const bool enabled );
+
+    static void CullFace( const GLenum mode );
+
+    static void DepthFunc( const GLenum func );
+
+    static void DepthMask( const bool enabled );
+
+    static void BlendFuncSeparate( const GLenum srcRGB,
+                                  const GLenum dstRGB,
+                                  const GLenum srcAlpha,
+                                  const GLenum dstAlpha );
+
+    ///
+    /// \brief Sets the polygon mode for GL_FRONT_AND_BACK.
+    static void PolygonMode( const GLenum mode );
+
+    static void Viewport( const GLint x,
+                          const GLint y,
+                          const GLsizei width,
+                          const GLsizei height );
+
+    static void ClearColor( const real r,
+                            const real g,
+                            const real b,
+                            const real a );
+
+  };
+
+}}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
@@ -26,6 +26,8 @@
 
 #include "RenderAPI.h"
 
+#include "GLState.h"
+
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
 
 namespace LocalNS {
@@ -86,15 +88,15 @@ void RenderAPI::setPolygonMode( const Lore::IRenderAPI::PolygonMode& mode )
   switch ( mode ) {
   default:
   case Lore::IRenderAPI::PolygonMode::Fill:
-    glPolygonMode( GL_FRONT_AND_BACK, GL_FILL );
+    GLState::PolygonMode( GL_FILL );
     break;
 
   case Lore::IRenderAPI::PolygonMode::Line:
-    glPolygonMode( GL_FRONT_AND_BACK, GL_LINE );
+    GLState::PolygonMode( GL_LINE );
     break;
 
   case Lore::IRenderAPI::PolygonMode::Point:
-    glPolygonMode( GL_FRONT_AND_BACK, GL_POINT );
+    GLState::PolygonMode( GL_POINT );
     break;
   }
 }
@@ -105,22 +107,22 @@ void RenderAPI::setCullingMode( const IRenderAPI::CullingMode mode )
 {
   switch ( mode ) {
   default:
-    glDisable( GL_CULL_FACE );
+    GLState::SetEnabled( GL_CULL_FACE, false );
     break;
 
   case CullingMode::Front:
-    glEnable( GL_CULL_FACE );
-    glCullFace( GL_FRONT );
+    GLState::SetEnabled( GL_CULL_FACE, true );
+    GLState::CullFace( GL_FRONT );
     break;
 
   case CullingMode::Back:
-    glEnable( GL_CULL_FACE );
-    glCullFace( GL_BACK );
+    GLState::SetEnabled( GL_CULL_FACE, true );
+    GLState::CullFace( GL_BACK );
     break;
 
   case CullingMode::FrontAndBack:
-    glEnable( GL_CULL_FACE );
-    glCullFace( GL_FRONT_AND_BACK );
+    GLState::SetEnabled( GL_CULL_FACE, true );
+    GLState::CullFace( GL_FRONT_AND_BACK );
     break;
   }
 }
@@ -132,7 +134,7 @@ void RenderAPI::clearColor( const real r,
                             const real b,
                             const real a )
 {
-  glClearColor( r, g, b, a );
+  GLState::ClearColor( r, g, b, a );
 }
 
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
@@ -163,7 +165,7 @@ void RenderAPI::setViewport( const uint32_t x,
                              const uint32_t width,
                              const uint32_t height )
 {
-  glViewport( x, y, width, height );
+  GLState::Viewport( x, y, width, height );
 }
 
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
@@ -177,19 +179,14 @@ void RenderAPI::bindDefaultFramebuffer()
 
 void RenderAPI::setDepthTestEnabled( const bool enabled )
 {
-  if ( enabled ) {
-    glEnable( GL_DEPTH_TEST );
-  }
-  else {
-    glDisable( GL_DEPTH_TEST );
-  }
+  GLState::SetEnabled( GL_DEPTH_TEST, enabled );
 }
 
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
 
 void RenderAPI::setDepthMaskEnabled( const bool enabled )
 {
-  glDepthMask( ( enabled ) ? GL_TRUE : GL_FALSE );
+  GLState::DepthMask( enabled );
 }
 
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
@@ -199,35 +196,35 @@ void RenderAPI::setDepthFunc( const DepthFunc func )
   switch ( func ) {
   default:
   case DepthFunc::Never:
-    glDepthFunc( GL_NEVER );
+    GLState::DepthFunc( GL_NEVER );
     break;
 
   case DepthFunc::Less:
-    glDepthFunc( GL_LESS );
+    GLState::DepthFunc( GL_LESS );
     break;
 
   case DepthFunc::LessEqual:
-    glDepthFunc( GL_LEQUAL );
+    GLState::DepthFunc( GL_LEQUAL );
     break;
     
   case DepthFunc::Equal:
-    glDepthFunc( GL_EQUAL );
+    GLState::DepthFunc( GL_EQUAL );
     break;
 
   case DepthFunc::Greater:
-    glDepthFunc( GL_GREATER );
+    GLState::DepthFunc( GL_GREATER );
     break;
 
   case DepthFunc::GreaterEqual:
-    glDepthFunc( GL_GEQUAL );
+    GLState::DepthFunc( GL_GEQUAL );
     break;
 
   case DepthFunc::NotEqual:
-    glDepthFunc( GL_NOTEQUAL );
+    GLState::DepthFunc( GL_NOTEQUAL );
     break;
 
   case DepthFunc::Always:
-    glDepthFunc( GL_ALWAYS );
+    GLState::DepthFunc( GL_ALWAYS );
     break; 
   }
 }
@@ -236,19 +233,28 @@ void RenderAPI::setDepthFunc( const DepthFunc func )
 
 void RenderAPI::setBlendingEnabled( const bool enabled )
 {
-  if ( enabled ) {
-    glEnable( GL_BLEND );
-  }
-  else {
-    glDisable( GL_BLEND );
-  }
+  GLState::SetEnabled( GL_BLEND, enabled );
 }
 
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
 
 void RenderAPI::setBlendingFunc( const Lore::BlendFactor& src, const Lore::BlendFactor& dst )
 {
-  glBlendFuncSeparate( ConvertBlendFactor( src ), ConvertBlendFactor( dst ), GL_ONE, GL_ONE );
+  GLState::BlendFuncSeparate( ConvertBlendFactor( src ), ConvertBlendFactor( dst ), GL_ONE, GL_ONE );
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+void RenderAPI::resetStateStats()
+{
+  GLState::ResetStats();
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+const Lore::IRenderAPI::StateStats& RenderAPI::getStateStats() const
+{
+  return GLState::GetStats();
 }
 
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
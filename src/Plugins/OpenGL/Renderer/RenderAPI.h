@@ -83,6 +83,13 @@ namespace Lore { namespace OpenGL {
 
     void setBlendingFunc( const BlendFactor& src, const BlendFactor& dst ) override;
 
+    //
+    // Statistics.
+
+    void resetStateStats() override;
+
+    const StateStats& getStateStats() const override;
+
     //
     // Debugging.
 #ifdef _DEBUG
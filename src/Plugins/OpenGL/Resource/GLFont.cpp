@@ -25,6 +25,7 @@
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
 
 #include <Plugins/OpenGL/Resource/GLFont.h>
+#include <Plugins/OpenGL/Renderer/GLState.h>
 
 #include <ft2build.h>
 #include FT_FREETYPE_H
@@ -74,7 +75,7 @@ void GLFont::loadFromFile( const string& file, const uint32_t size )
 
     GLuint texture;
     glGenTextures( 1, &texture );
-    glBindTexture( GL_TEXTURE_2D, texture );
+    GLState::BindTexture( GL_TEXTURE_2D, texture );
     glTexImage2D( GL_TEXTURE_2D,
                   0,
                   GL_RED,
@@ -100,7 +101,7 @@ void GLFont::loadFromFile( const string& file, const uint32_t size )
     _glyphs.insert( { c, glyph } );
   }
 
-  glBindTexture( GL_TEXTURE_2D, 0 );
+  GLState::BindTexture( GL_TEXTURE_2D, 0 );
 
   LogWrite( Info, "Successfully loaded font %s", file.c_str() );
 
@@ -141,8 +142,8 @@ Lore::Vertices GLFont::generateVertices( const char c,
 void GLFont::bindTexture( const char c )
 {
   const Glyph& glyph = _glyphs.at( c );
-  glActiveTexture( GL_TEXTURE0 );
-  glBindTexture( GL_TEXTURE_2D, glyph.textureID );
+  GLState::ActiveTexture( GL_TEXTURE0 );
+  GLState::BindTexture( GL_TEXTURE_2D, glyph.textureID );
 }
 
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
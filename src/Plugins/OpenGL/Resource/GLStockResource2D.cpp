@@ -38,6 +38,32 @@ using namespace Lore::OpenGL;
 
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
 
+namespace LocalNS {
+
+  // Cached uniform names, so updaters don't build strings every frame.
+  struct PointLightUniformNames
+  {
+    Lore::UniformNameTable pos { "pointLights[", "].pos" };
+    Lore::UniformNameTable ambient { "pointLights[", "].ambient" };
+    Lore::UniformNameTable diffuse { "pointLights[", "].diffuse" };
+    Lore::UniformNameTable specular { "pointLights[", "].specular" };
+    Lore::UniformNameTable range { "pointLights[", "].range" };
+    Lore::UniformNameTable constant { "pointLights[", "].constant" };
+    Lore::UniformNameTable linear { "pointLights[", "].linear" };
+    Lore::UniformNameTable quadratic { "pointLights[", "].quadratic" };
+    Lore::UniformNameTable intensity { "pointLights[", "].intensity" };
+  };
+
+  static PointLightUniformNames PointLightNames;
+  static Lore::UniformNameTable DiffuseTextureNames( "diffuseTexture" );
+  static Lore::UniformNameTable SpecularTextureNames( "specularTexture" );
+  static Lore::UniformNameTable DiffuseMixValueNames( "diffuseMixValues[", "]" );
+
+}
+using namespace LocalNS;
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
 GLStockResource2DFactory::GLStockResource2DFactory( Lore::ResourceControllerPtr controller )
   : StockResourceFactory( controller )
 {
@@ -350,19 +376,20 @@ Lore::GPUProgramPtr GLStockResource2DFactory::createUberProgram( const string& n
 
       int i = 0;
       for ( const auto& pair : lights.pointLights ) {
-        const string idx( "pointLights[" + std::to_string( i++ ) + "]" );
         const auto pointLight = pair.first;
         const auto pos = pair.second;
 
-        program->setUniformVar( idx + ".pos", glm::vec3( pos ) );
-        program->setUniformVar( idx + ".ambient", glm::vec3( pointLight->getAmbient() ) );
-        program->setUniformVar( idx + ".diffuse", glm::vec3( pointLight->getDiffuse() ) );
-        program->setUniformVar( idx + ".specular", glm::vec3( pointLight->getSpecular() ) );
-        program->setUniformVar( idx + ".range", pointLight->getRange() );
-        program->setUniformVar( idx + ".constant", pointLight->getConstant() );
-        program->setUniformVar( idx + ".linear", pointLight->getLinear() );
-        program->setUniformVar( idx + ".quadratic", pointLight->getQuadratic() );
-        program->setUniformVar( idx + ".intensity", pointLight->getIntensity() );
+        program->setUniformVar( PointLightNames.pos[i], glm::vec3( pos ) );
+        program->setUniformVar( PointLightNames.ambient[i], glm::vec3( pointLight->getAmbient() ) );
+        program->setUniformVar( PointLightNames.diffuse[i], glm::vec3( pointLight->getDiffuse() ) );
+        program->setUniformVar( PointLightNames.specular[i], glm::vec3( pointLight->getSpecular() ) );
+        program->setUniformVar( PointLightNames.range[i], pointLight->getRange() );
+        program->setUniformVar( PointLightNames.constant[i], pointLight->getConstant() );
+        program->setUniformVar( PointLightNames.linear[i], pointLight->getLinear() );
+        program->setUniformVar( PointLightNames.quadratic[i], pointLight->getQuadratic() );
+        program->setUniformVar( PointLightNames.intensity[i], pointLight->getIntensity() );
+
+        ++i;
       }
     }
   };
@@ -386,18 +413,18 @@ Lore::GPUProgramPtr GLStockResource2DFactory::createUberProgram( const string& n
       for ( int i = 0; i < diffuseCount; ++i ) {
         auto texture = sprite->getTexture( spriteFrame, Texture::Type::Diffuse, i );
         texture->bind( textureUnit );
-        program->setUniformVar( "diffuseTexture" + std::to_string( i ), textureUnit );
+        program->setUniformVar( DiffuseTextureNames[i], textureUnit );
         ++textureUnit;
       }
       for ( int i = 0; i < sprite->getTextureCount( spriteFrame, Texture::Type::Specular ); ++i ) {
         auto texture = sprite->getTexture( spriteFrame, Texture::Type::Specular, i );
         texture->bind( textureUnit );
-        program->setUniformVar( "specularTexture" + std::to_string( i ), textureUnit );
+        program->setUniformVar( SpecularTextureNames[i], textureUnit );
         ++textureUnit;
       }
       // Set mix values.
       for ( int i = 0; i < static_cast< int >( program->getDiffuseSamplerCount() ); ++i ) {
-        program->setUniformVar( "diffuseMixValues[" + std::to_string( i ) + "]",
+        program->setUniformVar( DiffuseMixValueNames[i],
                                 sprite->getMixValue( spriteFrame, Texture::Type::Diffuse, i ) );
       }
 
@@ -440,18 +467,18 @@ Lore::GPUProgramPtr GLStockResource2DFactory::createUberProgram( const string& n
       for ( int i = 0; i < diffuseCount; ++i ) {
         auto texture = sprite->getTexture( spriteFrame, Texture::Type::Diffuse, i );
         texture->bind( textureUnit );
-        program->setUniformVar( "diffuseTexture" + std::to_string( i ), textureUnit );
+        program->setUniformVar( DiffuseTextureNames[i], textureUnit );
         ++textureUnit;
       }
       for ( int i = 0; i < sprite->getTextureCount( spriteFrame, Texture::Type::Specular ); ++i ) {
         auto texture = sprite->getTexture( spriteFrame, Texture::Type::Specular, i );
         texture->bind( textureUnit );
-        program->setUniformVar( "specularTexture" + std::to_string( i ), textureUnit );
+        program->setUniformVar( SpecularTextureNames[i], textureUnit );
         ++textureUnit;
       }
       // Set mix values.
       for ( int i = 0; i < static_cast< int >( program->getDiffuseSamplerCount() ); ++i ) {
-        program->setUniformVar( "diffuseMixValues[" + std::to_string( i ) + "]",
+        program->setUniformVar( DiffuseMixValueNames[i],
                                 sprite->getMixValue( spriteFrame, Texture::Type::Diffuse, i ) );
       }
 
@@ -43,6 +43,46 @@ constexpr int instancedMatrixTexUnit = 5;
 
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
 
+namespace LocalNS {
+
+  // Cached uniform names, so updaters don't build strings every frame.
+  struct DirLightUniformNames
+  {
+    Lore::UniformNameTable ambient { "dirLights[", "].ambient" };
+    Lore::UniformNameTable diffuse { "dirLights[", "].diffuse" };
+    Lore::UniformNameTable specular { "dirLights[", "].specular" };
+    Lore::UniformNameTable direction { "dirLights[", "].direction" };
+  };
+
+  struct PointLightUniformNames
+  {
+    Lore::UniformNameTable pos { "pointLights[", "].pos" };
+    Lore::UniformNameTable ambient { "pointLights[", "].ambient" };
+    Lore::UniformNameTable diffuse { "pointLights[", "].diffuse" };
+    Lore::UniformNameTable specular { "pointLights[", "].specular" };
+    Lore::UniformNameTable range { "pointLights[", "].range" };
+    Lore::UniformNameTable constant { "pointLights[", "].constant" };
+    Lore::UniformNameTable linear { "pointLights[", "].linear" };
+    Lore::UniformNameTable quadratic { "pointLights[", "].quadratic" };
+    Lore::UniformNameTable intensity { "pointLights[", "].intensity" };
+    Lore::UniformNameTable shadowFarPlane { "pointLights[", "].shadowFarPlane" };
+  };
+
+  static DirLightUniformNames DirLightNames;
+  static PointLightUniformNames PointLightNames;
+  static Lore::UniformNameTable DirLightShadowMapNames( "dirLightShadowMap[", "]" );
+  static Lore::UniformNameTable DirLightSpaceMatrixNames( "dirLightSpaceMatrix[", "]" );
+  static Lore::UniformNameTable ShadowCubemapNames( "shadowCubemap[", "]" );
+  static Lore::UniformNameTable DiffuseTextureNames( "diffuseTexture" );
+  static Lore::UniformNameTable SpecularTextureNames( "specularTexture" );
+  static Lore::UniformNameTable NormalTextureNames( "normalTexture" );
+  static Lore::UniformNameTable DiffuseMixValueNames( "diffuseMixValues[", "]" );
+
+}
+using namespace LocalNS;
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
 GLStockResource3DFactory::GLStockResource3DFactory( Lore::ResourceControllerPtr controller )
   : StockResourceFactory( controller )
 {
@@ -773,16 +813,15 @@ Lore::GPUProgramPtr GLStockResource3DFactory::createUberProgram( const string& n
       int shadowMapTexUnit = 10;
       u8 i = 0;
       for ( const auto& directionalLight : lights.directionalLights ) {
-        const string idx( "dirLights[" + std::to_string( i ) + "]" );
-        program->setUniformVar( idx + ".ambient", glm::vec3( directionalLight->getAmbient() ) );
-        program->setUniformVar( idx + ".diffuse", glm::vec3( directionalLight->getDiffuse() ) );
-        program->setUniformVar( idx + ".specular", glm::vec3( directionalLight->getSpecular() ) );
-        program->setUniformVar( idx + ".direction", glm::vec3( directionalLight->getDirection() ) );
+        program->setUniformVar( DirLightNames.ambient[i], glm::vec3( directionalLight->getAmbient() ) );
+        program->setUniformVar( DirLightNames.diffuse[i], glm::vec3( directionalLight->getDiffuse() ) );
+        program->setUniformVar( DirLightNames.specular[i], glm::vec3( directionalLight->getSpecular() ) );
+        program->setUniformVar( DirLightNames.direction[i], glm::vec3( directionalLight->getDirection() ) );
 
         if ( directionalLight->shadowMap ) {
           directionalLight->shadowMap->getTexture()->bind( shadowMapTexUnit );
-          program->setUniformVar( "dirLightShadowMap[" + std::to_string( i ) + "]", shadowMapTexUnit );
-          program->setUniformVar( "dirLightSpaceMatrix[" + std::to_string( i ) + "]", directionalLight->viewProj );
+          program->setUniformVar( DirLightShadowMapNames[i], shadowMapTexUnit );
+          program->setUniformVar( DirLightSpaceMatrixNames[i], directionalLight->viewProj );
 
           ++shadowMapTexUnit;
         }
@@ -793,25 +832,24 @@ Lore::GPUProgramPtr GLStockResource3DFactory::createUberProgram( const string& n
       shadowMapTexUnit = 12; // TODO: Config shadow map tex units?
       i = 0;
       for ( const auto& pair : lights.pointLights ) {
-        const string idx( "pointLights[" + std::to_string( i ) + "]" );
         const auto pointLight = pair.first;
         const auto pos = pair.second;
 
-        program->setUniformVar( idx + ".pos", glm::vec3( pos ) );
-        program->setUniformVar( idx + ".ambient", glm::vec3( pointLight->getAmbient() ) );
-        program->setUniformVar( idx + ".diffuse", glm::vec3( pointLight->getDiffuse() ) );
-        program->setUniformVar( idx + ".specular", glm::vec3( pointLight->getSpecular() ) );
-        program->setUniformVar( idx + ".range", pointLight->getRange() );
-        program->setUniformVar( idx + ".constant", pointLight->getConstant() );
-        program->setUniformVar( idx + ".linear", pointLight->getLinear() );
-        program->setUniformVar( idx + ".quadratic", pointLight->getQuadratic() );
-        program->setUniformVar( idx + ".intensity", pointLight->getIntensity() );
+        program->setUniformVar( PointLightNames.pos[i], glm::vec3( pos ) );
+        program->setUniformVar( PointLightNames.ambient[i], glm::vec3( pointLight->getAmbient() ) );
+        program->setUniformVar( PointLightNames.diffuse[i], glm::vec3( pointLight->getDiffuse() ) );
+        program->setUniformVar( PointLightNames.specular[i], glm::vec3( pointLight->getSpecular() ) );
+        program->setUniformVar( PointLightNames.range[i], pointLight->getRange() );
+        program->setUniformVar( PointLightNames.constant[i], pointLight->getConstant() );
+        program->setUniformVar( PointLightNames.linear[i], pointLight->getLinear() );
+        program->setUniformVar( PointLightNames.quadratic[i], pointLight->getQuadratic() );
+        program->setUniformVar( PointLightNames.intensity[i], pointLight->getIntensity() );
 
         if ( pointLight->shadowMap ) {
-          program->setUniformVar( idx + ".shadowFarPlane", pointLight->shadowFarPlane );
+          program->setUniformVar( PointLightNames.shadowFarPlane[i], pointLight->shadowFarPlane );
 
           pointLight->shadowMap->getTexture()->bind( shadowMapTexUnit );
-          program->setUniformVar( "shadowCubemap[" + std::to_string( i ) + "]", shadowMapTexUnit );
+          program->setUniformVar( ShadowCubemapNames[i], shadowMapTexUnit );
 
           ++shadowMapTexUnit;
 
@@ -826,7 +864,7 @@ Lore::GPUProgramPtr GLStockResource3DFactory::createUberProgram( const string& n
       // Assign the last shadow map to any unused shadow maps so they don't get filled with the skybox cubemap.
       --shadowMapTexUnit;
       for ( u8 j = i; j < program->maxPointLights; ++j ) {
-        program->setUniformVar( "shadowCubemap[" + std::to_string( j ) + "]", shadowMapTexUnit );
+        program->setUniformVar( ShadowCubemapNames[j], shadowMapTexUnit );
       }
     }
   };
@@ -849,25 +887,25 @@ Lore::GPUProgramPtr GLStockResource3DFactory::createUberProgram( const string& n
       for ( u8 i = 0; i < diffuseCount; ++i ) {
         auto texture = sprite->getTexture( spriteFrame, Texture::Type::Diffuse, i );
         texture->bind( textureUnit );
-        program->setUniformVar( "diffuseTexture" + std::to_string( i ), textureUnit );
+        program->setUniformVar( DiffuseTextureNames[i], textureUnit );
         ++textureUnit;
       }
       for ( u8 i = 0; i < sprite->getTextureCount( spriteFrame, Texture::Type::Specular ); ++i ) {
         auto texture = sprite->getTexture( spriteFrame, Texture::Type::Specular, i );
         texture->bind( textureUnit );
-        program->setUniformVar( "specularTexture" + std::to_string( i ), textureUnit );
+        program->setUniformVar( SpecularTextureNames[i], textureUnit );
         ++textureUnit;
       }
       for ( u8 i = 0; i < sprite->getTextureCount( spriteFrame, Texture::Type::Normal ); ++i ) {
         auto texture = sprite->getTexture( spriteFrame, Texture::Type::Normal, i );
         texture->bind( textureUnit );
-        program->setUniformVar( "normalTexture" + std::to_string( i ), textureUnit );
+        program->setUniformVar( NormalTextureNames[i], textureUnit );
         ++textureUnit;
       }
 
       // Set mix values.
       for ( int i = 0; i < static_cast<int>( program->getDiffuseSamplerCount() ); ++i ) {
-        program->setUniformVar( "diffuseMixValues[" + std::to_string( i ) + "]",
+        program->setUniformVar( DiffuseMixValueNames[i],
                                 sprite->getMixValue( spriteFrame, Texture::Type::Diffuse, i ) );
       }
 
@@ -910,25 +948,25 @@ Lore::GPUProgramPtr GLStockResource3DFactory::createUberProgram( const string& n
       for ( int i = 0; i < diffuseCount; ++i ) {
         auto texture = sprite->getTexture( spriteFrame, Texture::Type::Diffuse, i );
         texture->bind( textureUnit );
-        program->setUniformVar( "diffuseTexture" + std::to_string( i ), textureUnit );
+        program->setUniformVar( DiffuseTextureNames[i], textureUnit );
         ++textureUnit;
       }
       for ( int i = 0; i < sprite->getTextureCount( spriteFrame, Texture::Type::Specular ); ++i ) {
         auto texture = sprite->getTexture( spriteFrame, Texture::Type::Specular, i );
         texture->bind( textureUnit );
-        program->setUniformVar( "specularTexture" + std::to_string( i ), textureUnit );
+        program->setUniformVar( SpecularTextureNames[i], textureUnit );
         ++textureUnit;
       }
       for ( u8 i = 0; i < sprite->getTextureCount( spriteFrame, Texture::Type::Normal ); ++i ) {
         auto texture = sprite->getTexture( spriteFrame, Texture::Type::Normal, i );
         texture->bind( textureUnit );
-        program->setUniformVar( "normalTexture" + std::to_string( i ), textureUnit );
+        program->setUniformVar( NormalTextureNames[i], textureUnit );
         ++textureUnit;
       }
 
       // Set mix values.
       for ( int i = 0; i < static_cast<int>( program->getDiffuseSamplerCount() ); ++i ) {
-        program->setUniformVar( "diffuseMixValues[" + std::to_string( i ) + "]",
+        program->setUniformVar( DiffuseMixValueNames[i],
                                 sprite->getMixValue( spriteFrame, Texture::Type::Diffuse, i ) );
       }
 
@@ -26,6 +26,8 @@
 
 #include "GLTexture.h"
 
+#include <Plugins/OpenGL/Renderer/GLState.h>
+
 #define STB_IMAGE_IMPLEMENTATION
 #include <Plugins/ThirdParty/stb_image.h>
 
@@ -37,7 +39,7 @@ using namespace Lore::OpenGL;
 
 GLTexture::~GLTexture()
 {
-  glDeleteTextures( _texCount, _id );
+  GLState::DeleteTextures( _texCount, _id );
 }
 
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
@@ -52,7 +54,7 @@ void GLTexture::loadFromFile( const string& file, const bool srgb )
   unsigned char* pixels = stbi_load( file.c_str(), &width, &height, &n, STBI_rgb_alpha );
   if ( pixels ) {
     glGenTextures( 1, _id );
-    glBindTexture( _target, _id[0] );
+    GLState::BindTexture( _target, _id[0] );
 
     glTexImage2D( _target, 0, ( srgb ) ? GL_SRGB_ALPHA : GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels );
 
@@ -70,7 +72,7 @@ void GLTexture::loadFromFile( const string& file, const bool srgb )
     glTexParameteri( _target, GL_TEXTURE_MAG_FILTER, GL_LINEAR );
 
     stbi_image_free( pixels );
-    glBindTexture( _target, 0 );
+    GLState::BindTexture( _target, 0 );
   }
   else {
     throw Lore::Exception( "Unable to load texture at " + file );
@@ -85,7 +87,7 @@ void GLTexture::loadCubemap( const std::vector<string>& files )
 
   // Generate cubemap texture.
   glGenTextures( 1, _id );
-  glBindTexture( _target, _id[0] );
+  GLState::BindTexture( _target, _id[0] );
 
   // Load each cubemap texture.
   int width, height, comp;
@@ -114,7 +116,7 @@ void GLTexture::loadCubemap( const std::vector<string>& files )
   glTexParameteri( _target, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE );
   glTexParameteri( _target, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE );
 
-  glBindTexture( _target, 0 );
+  GLState::BindTexture( _target, 0 );
 }
 
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
@@ -125,14 +127,14 @@ void GLTexture::create( const uint32_t width, const uint32_t height, const uint3
 
   if ( sampleCount ) {
     _target = GL_TEXTURE_2D_MULTISAMPLE;
-    glBindTexture( _target, _id[0] );
+    GLState::BindTexture( _target, _id[0] );
 
     // Create texture.
     glTexImage2DMultisample( _target, sampleCount, GL_RGB, width, height, GL_TRUE );
   }
   else {
     _target = GL_TEXTURE_2D;
-    glBindTexture( _target, _id[0] );
+    GLState::BindTexture( _target, _id[0] );
 
     // Create texture.
     glTexImage2D( _target, 0, GL_RGB, width, height, 0, GL_RGB, GL_UNSIGNED_BYTE, nullptr );
@@ -141,7 +143,7 @@ void GLTexture::create( const uint32_t width, const uint32_t height, const uint3
     glTexParameteri( _target, GL_TEXTURE_MAG_FILTER, GL_LINEAR );
   }
 
-  glBindTexture( _target, 0 );
+  GLState::BindTexture( _target, 0 );
 }
 
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
@@ -149,7 +151,7 @@ void GLTexture::create( const uint32_t width, const uint32_t height, const uint3
 void GLTexture::createDepth( const uint32_t width, const uint32_t height )
 {
   glGenTextures( 1, _id );
-  glBindTexture( GL_TEXTURE_2D, _id[0] );
+  GLState::BindTexture( GL_TEXTURE_2D, _id[0] );
   glTexImage2D( GL_TEXTURE_2D, 0, GL_DEPTH_COMPONENT, width, height, 0, GL_DEPTH_COMPONENT, GL_FLOAT, nullptr );
   glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST );
   glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST );
@@ -159,7 +161,7 @@ void GLTexture::createDepth( const uint32_t width, const uint32_t height )
   float borderColor[] = { 1.0f, 1.0f, 1.0f, 1.0f };
   glTexParameterfv( GL_TEXTURE_2D, GL_TEXTURE_BORDER_COLOR, borderColor );
 
-  glBindTexture( _target, 0 );
+  GLState::BindTexture( _target, 0 );
 }
 
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
@@ -168,7 +170,7 @@ void GLTexture::createCubemap( const uint32_t width, const uint32_t height )
 {
   _target = GL_TEXTURE_CUBE_MAP;
   glGenTextures( 1, _id );
-  glBindTexture( _target, _id[0] );
+  GLState::BindTexture( _target, _id[0] );
 
   for ( uint32_t i = 0; i < 6; ++i ) {
     glTexImage2D( GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, GL_DEPTH_COMPONENT, width, height, 0, GL_DEPTH_COMPONENT, GL_FLOAT, nullptr );
@@ -180,7 +182,7 @@ void GLTexture::createCubemap( const uint32_t width, const uint32_t height )
   glTexParameteri( GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE );
   glTexParameteri( GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE );
 
-  glBindTexture( _target, 0 );
+  GLState::BindTexture( _target, 0 );
 }
 
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
@@ -194,7 +196,7 @@ void GLTexture::createFloatingPoint( const u32 width, const u32 height, const u3
     glGenTextures( texCount, _id );
 
     for ( u32 i = 0; i < texCount; ++i ) {
-      glBindTexture( _target, _id[i] );
+      GLState::BindTexture( _target, _id[i] );
 
       // Create texture.
 
@@ -212,7 +214,7 @@ void GLTexture::createFloatingPoint( const u32 width, const u32 height, const u3
     glGenTextures( texCount, _id );
 
     for ( u32 i = 0; i < texCount; ++i ) {
-      glBindTexture( _target, _id[i] );
+      GLState::BindTexture( _target, _id[i] );
 
       glTexImage2D( _target, 0, GL_RGBA16F, width, height, 0, GL_RGBA, GL_FLOAT, nullptr );
 
@@ -223,7 +225,7 @@ void GLTexture::createFloatingPoint( const u32 width, const u32 height, const u3
     }
   }
 
-  glBindTexture( _target, 0 );
+  GLState::BindTexture( _target, 0 );
 
   _texCount = texCount;
 }
@@ -264,22 +266,22 @@ void GLTexture::create( const int width, const int height, const Lore::Color& co
   _createGLTexture( pixels, width, height, false );
 
   delete[] pixels;
-  glBindTexture( GL_TEXTURE_2D, 0 );
+  GLState::BindTexture( GL_TEXTURE_2D, 0 );
 }
 
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
 
 void GLTexture::bind( const u32 activeIdx, const u32 texIdx )
 {
-  glActiveTexture( GL_TEXTURE0 + activeIdx);
-  glBindTexture( _target, _id[texIdx] );
+  GLState::ActiveTexture( GL_TEXTURE0 + activeIdx);
+  GLState::BindTexture( _target, _id[texIdx] );
 }
 
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
 
 void GLTexture::setDefaultActiveTexture()
 {
-  glActiveTexture( GL_TEXTURE0 );
+  GLState::ActiveTexture( GL_TEXTURE0 );
 }
 
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
@@ -288,7 +290,7 @@ void GLTexture::setDefaultActiveTexture()
 void GLTexture::_createGLTexture( const unsigned char* pixels, const int width, const int height, const bool srgb, const bool genMipMaps )
 {
   glGenTextures( 1, _id );
-  glBindTexture( _target, _id[0] );
+  GLState::BindTexture( _target, _id[0] );
 
   // Create the OpenGL texture.
   glTexImage2D( _target, 0, ( srgb ) ? GL_SRGB_ALPHA : GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels );
@@ -29,16 +29,31 @@
 #include <LORE/Resource/ResourceController.h>
 #include <LORE/Shader/GPUProgram.h>
 
+#include <Plugins/OpenGL/Renderer/GLState.h>
+
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
 
 using namespace Lore::OpenGL;
 
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
 
+namespace LocalNS {
+
+  // Cached uniform names, so drawing doesn't build strings every frame.
+  static Lore::UniformNameTable DiffuseTextureNames( "diffuseTexture" );
+  static Lore::UniformNameTable SpecularTextureNames( "specularTexture" );
+  static Lore::UniformNameTable NormalTextureNames( "normalTexture" );
+  static Lore::UniformNameTable DiffuseMixValueNames( "diffuseMixValues[", "]" );
+
+}
+using namespace LocalNS;
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
 GLMesh::~GLMesh()
 {
   glDeleteBuffers( 1, &_vbo );
-  glDeleteBuffers( 1, &_vao );
+  GLState::DeleteVertexArray( _vao );
   glDeleteBuffers( 1, &_ebo );
   glDeleteBuffers( 1, &_instancedVBO );
 }
@@ -167,13 +182,13 @@ void GLMesh::init( const Lore::Mesh::Type type )
     // Text VBs are a special case and require dynamic drawing.
     glGenVertexArrays( 1, &_vao );
     glGenBuffers( 1, &_vbo );
-    glBindVertexArray( _vao );
+    GLState::BindVertexArray( _vao );
     glBindBuffer( GL_ARRAY_BUFFER, _vbo );
     glBufferData( GL_ARRAY_BUFFER, sizeof( GLfloat ) * 6 * 4, nullptr, GL_DYNAMIC_DRAW );
     glEnableVertexAttribArray( 0 );
     glVertexAttribPointer( 0, 4, GL_FLOAT, GL_FALSE, 4 * sizeof( GLfloat ), nullptr );
     glBindBuffer( GL_ARRAY_BUFFER, 0 );
-    glBindVertexArray( 0 );
+    GLState::BindVertexArray( 0 );
     _attributes.clear();
     return; // Early return for special case.
 
@@ -351,7 +366,7 @@ void GLMesh::init( const Lore::Mesh::Type type )
   glGenVertexArrays( 1, &_vao );
   glGenBuffers( 1, &_vbo );
 
-  glBindVertexArray( _vao );
+  GLState::BindVertexArray( _vao );
 
   glBindBuffer( GL_ARRAY_BUFFER, _vbo );
   glBufferData( GL_ARRAY_BUFFER, sizeof( GLfloat ) * _vertices.size(), _vertices.data(), GL_STATIC_DRAW );
@@ -372,6 +387,11 @@ void GLMesh::init( const Lore::Mesh::Type type )
     stride += attr.size;
   }
 
+  // Fit local bounds around the vertex positions (always the first attribute).
+  if ( !_vertices.empty() && !_attributes.empty() ) {
+    computeBounds( _vertices, static_cast< size_t >( stride ), static_cast< size_t >( _attributes.front().size ) );
+  }
+
   // Build each attribute.
   for ( const auto& attr : _attributes ) {
     GLenum type = 0;
@@ -401,7 +421,7 @@ void GLMesh::init( const Lore::Mesh::Type type )
     offset += attr.size;
   }
 
-  glBindVertexArray( 0 );
+  GLState::BindVertexArray( 0 );
 
   _attributes.clear(); // Attributes no longer needed.
 }
@@ -419,7 +439,7 @@ void GLMesh::init( const CustomMeshData& data )
   glGenVertexArrays( 1, &_vao );
   glGenBuffers( 1, &_vbo );
   glGenBuffers( 1, &_ebo );
-  glBindVertexArray( _vao );
+  GLState::BindVertexArray( _vao );
 
   glBindBuffer( GL_ARRAY_BUFFER, _vbo );
   glBufferData( GL_ARRAY_BUFFER, sizeof( Vertex ) * data.verts.size(), data.verts.data(), GL_STATIC_DRAW );
@@ -449,7 +469,9 @@ void GLMesh::init( const CustomMeshData& data )
 
   _indices = data.indices;
 
-  glBindVertexArray( 0 );
+  GLState::BindVertexArray( 0 );
+
+  computeBounds( data.verts );
 }
 
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
@@ -491,7 +513,7 @@ void GLMesh::initInstanced( const Type type, const size_t maxCount )
   }
 
   // Bind the existing vertex array to add instanced buffer data to it.
-  glBindVertexArray( _vao );
+  GLState::BindVertexArray( _vao );
 
   // Generate a new vertex buffer for instanced data.
   glGenBuffers( 1, &_instancedVBO );
@@ -525,7 +547,7 @@ void GLMesh::initInstanced( const Type type, const size_t maxCount )
     glVertexAttribDivisor( attribIdx, 1 );
   }
 
-  glBindVertexArray( 0 );
+  GLState::BindVertexArray( 0 );
 
   _type = type;
 }
@@ -545,6 +567,40 @@ void GLMesh::updateInstanced( const size_t idx, const glm::mat4& matrix )
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
 
 void GLMesh::draw( const Lore::GPUProgramPtr program, const size_t instanceCount, const bool bindTextures, const bool applyMaterial )
+{
+  _draw( program, _instancedMatrices.data(), _instancedMatrices.size(), instanceCount, bindTextures, applyMaterial );
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+void GLMesh::draw( const Lore::Vertices& verts )
+{
+  assert( Mesh::Type::Text == _type );
+
+  GLState::BindVertexArray( _vao );
+  glBindBuffer( GL_ARRAY_BUFFER, _vbo );
+  glBufferSubData( GL_ARRAY_BUFFER, 0, verts.size() * sizeof( real ), verts.data() );
+  glBindBuffer( GL_ARRAY_BUFFER, 0 );
+
+  glDrawArrays( GL_TRIANGLES, 0, 6 );
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+void GLMesh::drawInstances( const Lore::GPUProgramPtr program, const glm::mat4* matrices, const size_t count, const bool bindTextures, const bool applyMaterial )
+{
+  _draw( program, matrices, count, count, bindTextures, applyMaterial );
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+void GLMesh::_draw( const Lore::GPUProgramPtr program,
+                    const glm::mat4* matrices,
+                    const size_t matrixCount,
+                    const size_t instanceCount,
+                    const bool bindTextures,
+                    const bool applyMaterial )
 {
   // Apply custom material settings for this mesh.
   if ( program->allowMeshMaterialSettings && applyMaterial && _material ) {
@@ -565,31 +621,31 @@ void GLMesh::draw( const Lore::GPUProgramPtr program, const size_t instanceCount
     for ( u8 i = 0; i < diffuseCount; ++i ) {
       auto texture = _sprite.getTexture( 0, Texture::Type::Diffuse, i );
       texture->bind( textureUnit );
-      program->setUniformVar( "diffuseTexture" + std::to_string( i ), textureUnit );
+      program->setUniformVar( DiffuseTextureNames[i], textureUnit );
       ++textureUnit;
     }
     for ( u8 i = 0; i < specularCount; ++i ) {
       auto texture = _sprite.getTexture( 0, Texture::Type::Specular, i );
       texture->bind( textureUnit );
-      program->setUniformVar( "specularTexture" + std::to_string( i ), textureUnit );
+      program->setUniformVar( SpecularTextureNames[i], textureUnit );
       ++textureUnit;
     }
     for ( u8 i = 0; i < normalCount; ++i ) {
       auto texture = _sprite.getTexture( 0, Texture::Type::Normal, i );
       texture->bind( textureUnit );
-      program->setUniformVar( "normalTexture" + std::to_string( i ), textureUnit );
+      program->setUniformVar( NormalTextureNames[i], textureUnit );
       ++textureUnit;
     }
     // Set mix values.
     if ( diffuseCount ) {
       for ( u8 i = 0; i < static_cast<int>( program->getDiffuseSamplerCount() ); ++i ) {
-        program->setUniformVar( "diffuseMixValues[" + std::to_string( i ) + "]",
+        program->setUniformVar( DiffuseMixValueNames[i],
                                 _sprite.getMixValue( 0, Texture::Type::Diffuse, i ) );
       }
     }
   }
 
-  glBindVertexArray( _vao );
+  GLState::BindVertexArray( _vao );
   switch ( _type ) {
   default:
     glDrawArrays( _mode, 0, 3 );
@@ -607,7 +663,7 @@ void GLMesh::draw( const Lore::GPUProgramPtr program, const size_t instanceCount
   case Mesh::Type::TexturedQuad3DInstanced:
   case Mesh::Type::CustomInstanced:
     glBindBuffer( GL_ARRAY_BUFFER, _instancedVBO );
-    glBufferData( GL_ARRAY_BUFFER, _instancedMatrices.size() * sizeof( glm::mat4 ), &_instancedMatrices.data()[0], GL_STATIC_DRAW );
+    glBufferData( GL_ARRAY_BUFFER, matrixCount * sizeof( glm::mat4 ), matrices, GL_STATIC_DRAW );
     glDrawElementsInstanced( _mode, static_cast< GLsizei >( _indices.size() ), GL_UNSIGNED_INT, nullptr, static_cast< GLsizei >( instanceCount ) );
     glBindBuffer( GL_ARRAY_BUFFER, 0 );
     break;
@@ -615,7 +671,7 @@ void GLMesh::draw( const Lore::GPUProgramPtr program, const size_t instanceCount
   case Mesh::Type::CubeInstanced:
   case Mesh::Type::TexturedCubeInstanced:
     glBindBuffer( GL_ARRAY_BUFFER, _instancedVBO );
-    glBufferData( GL_ARRAY_BUFFER, _instancedMatrices.size() * sizeof( glm::mat4 ), &_instancedMatrices.data()[0], GL_STATIC_DRAW );
+    glBufferData( GL_ARRAY_BUFFER, matrixCount * sizeof( glm::mat4 ), matrices, GL_STATIC_DRAW );
     glDrawArraysInstanced( _mode, 0, 36, static_cast< GLsizei >( instanceCount ) );
     glBindBuffer( GL_ARRAY_BUFFER, 0 );
     break;
@@ -631,28 +687,14 @@ void GLMesh::draw( const Lore::GPUProgramPtr program, const size_t instanceCount
     glDrawArrays( _mode, 0, 36 );
     break;
   }
-  glBindVertexArray( 0 );
+  // The VAO stays bound, so consecutive draws of this mesh don't rebind it.
+  // Every path that edits vertex array state binds its own VAO first.
 
   // Unbind textures to avoid any textures leaking into the next mesh of a model.
   for ( u8 i = 0; i < ( diffuseCount + specularCount + normalCount ); ++i ) {
-    glActiveTexture( GL_TEXTURE0 + i );
-    glBindTexture( GL_TEXTURE_2D, 0 );
+    GLState::ActiveTexture( GL_TEXTURE0 + i );
+    GLState::BindTexture( GL_TEXTURE_2D, 0 );
   }
 }
 
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
-
-void GLMesh::draw( const Lore::Vertices& verts )
-{
-  assert( Mesh::Type::Text == _type );
-
-  glBindVertexArray( _vao );
-  glBindBuffer( GL_ARRAY_BUFFER, _vbo );
-  glBufferSubData( GL_ARRAY_BUFFER, 0, verts.size() * sizeof( real ), verts.data() );
-  glBindBuffer( GL_ARRAY_BUFFER, 0 );
-
-  glDrawArrays( GL_TRIANGLES, 0, 6 );
-  glBindVertexArray( 0 );
-}
-
-// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
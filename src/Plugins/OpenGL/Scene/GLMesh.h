@@ -48,6 +48,14 @@ namespace Lore { namespace OpenGL {
     GLenum _mode { GL_TRIANGLE_STRIP };
     GLenum _glType { GL_UNSIGNED_INT };
 
+    // Instanced types upload matrixCount matrices before drawing.
+    void _draw( const GPUProgramPtr program,
+                const glm::mat4* matrices,
+                const size_t matrixCount,
+                const size_t instanceCount,
+                const bool bindTextures,
+                const bool applyMaterial );
+
   public:
 
     GLMesh() = default;
@@ -61,6 +69,7 @@ namespace Lore { namespace OpenGL {
 
     void draw( const GPUProgramPtr program, const size_t instanceCount, const bool bindTextures, const bool applyMaterial = true ) override;
     void draw( const Vertices& verts ) override;
+    void drawInstances( const GPUProgramPtr program, const glm::mat4* matrices, const size_t count, const bool bindTextures, const bool applyMaterial = true ) override;
 
   };
 
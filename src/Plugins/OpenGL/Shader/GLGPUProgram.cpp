@@ -29,6 +29,8 @@
 #include <LORE/Scene/Light.h>
 #include <LORE/Shader/Shader.h>
 
+#include <Plugins/OpenGL/Renderer/GLState.h>
+
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
 
 using namespace Lore::OpenGL;
@@ -102,7 +104,7 @@ bool GLGPUProgram::link()
 
 void GLGPUProgram::use()
 {
-  glUseProgram( _program );
+  GLState::UseProgram( _program );
 }
 
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
@@ -33,6 +33,7 @@
 #include <LORE/Core/APIVersion.h>
 #include <LORE/Core/NotificationCenter.h>
 #include <LORE/UI/UI.h>
+#include <Plugins/OpenGL/Renderer/GLState.h>
 #include <Plugins/OpenGL/Resource/GLResourceController.h>
 #include <Plugins/OpenGL/Resource/GLStockResource.h>
 #include <UI/imgui_impl_glfw.h>
@@ -89,6 +90,7 @@ void GLWindow::init( const string& title,
   // and then restore the previous one).
   GLFWwindow* currentContext = glfwGetCurrentContext();
   glfwMakeContextCurrent( _window );
+  GLState::Invalidate();
 
   _stockController = std::make_unique<GLStockResourceController>();
   _stockController->createStockResources();
@@ -99,6 +101,7 @@ void GLWindow::init( const string& title,
   _stockController->createRendererStockResources( RendererType::Forward3D );
 
   glfwMakeContextCurrent( currentContext );
+  GLState::Invalidate();
 
   // Setup Platform/Renderer bindings
   ImGui_ImplGlfw_InitForOpenGL( _window, false );
@@ -125,6 +128,10 @@ void GLWindow::renderFrame()
     return;
   }
 
+  // Another window's context may have been current since this one last
+  // rendered, so the state shadow can't be trusted.
+  GLState::Invalidate();
+
   // Render each Scene with the corresponding RenderView data.
   for ( const RenderView& rv : _renderViews ) {
     RendererPtr renderer = rv.scene->getRenderer();
@@ -204,6 +211,7 @@ void GLWindow::setDimensions( const int width, const int height )
 void GLWindow::setActive()
 {
   glfwMakeContextCurrent( _window );
+  GLState::Invalidate();
 }
 
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
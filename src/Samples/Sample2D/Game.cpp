@@ -144,8 +144,10 @@ void Game::loadScene()
 #endif
   stonePrefab->enableInstancing( count );
   stonePrefab->setSprite( Lore::Resource::GetSprite( "stone2d" ) );
+  const auto stoneNodes = _scene->createNodes( count / 2, nullptr, "stone" );
+  const auto stoneNodes2 = _scene->createNodes( count / 2, nullptr, "2stone" );
   for ( int i = 0; i < count / 2; ++i ) {
-    auto stoneNode = _scene->createNode( "stone" + std::to_string( i ) );
+    auto stoneNode = stoneNodes[i];
     stoneNode->attachObject( stonePrefab );
 
     stoneNode->scale( 2.f );
@@ -153,7 +155,7 @@ void Game::loadScene()
     stoneNode->setPosition( -4.f + static_cast< Lore::real >( i * 0.4f ), 0.f );
 
     // Add a 2nd row that will go above the stained glass.
-    auto stoneNode2 = _scene->createNode( "2stone" + std::to_string( i ) );
+    auto stoneNode2 = stoneNodes2[i];
     stoneNode2->attachObject( stonePrefab );
     stoneNode2->scale( 2.f );
     stoneNode2->setDepth( 10.f );
@@ -286,8 +286,10 @@ void Game::loadScene2D()
   const size_t count = 40;
   stonePrefab->enableInstancing( count );
   stonePrefab->setSprite( Lore::Resource::GetSprite( "stone2d" ) );
+  const auto stoneNodes = _scene2D->createNodes( count / 2, nullptr, "stone" );
+  const auto stoneNodes2 = _scene2D->createNodes( count / 2, nullptr, "2stone" );
   for ( int i = 0; i < count / 2; ++i ) {
-    auto stoneNode = _scene2D->createNode( "stone" + std::to_string( i ) );
+    auto stoneNode = stoneNodes[i];
     stoneNode->attachObject( stonePrefab );
 
     stoneNode->scale( 2.f );
@@ -295,7 +297,7 @@ void Game::loadScene2D()
     stoneNode->setPosition( -4.f + static_cast<Lore::real>( i * 0.4f ), 0.f );
 
     // Add a 2nd row that will go above the stained glass.
-    auto stoneNode2 = _scene2D->createNode( "2stone" + std::to_string( i ) );
+    auto stoneNode2 = stoneNodes2[i];
     stoneNode2->attachObject( stonePrefab );
     stoneNode2->scale( 2.f );
     stoneNode2->setDepth( 10.f );
@@ -0,0 +1,170 @@
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+// The MIT License (MIT)
+// This source file is part of LORE
+// ( Lightweight Object-oriented Rendering Engine )
+//
+// Copyright (c) 2017-2021 Jordan Sparks
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files ( the "Software" ), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+
+#include "catch.hpp"
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+TEST_CASE( "Job system", "[jobs]" )
+{
+  constexpr const uint32_t jobCount = 1000;
+
+  SECTION( "Jobs run to completion" )
+  {
+    Lore::JobSystem jobs( 4 );
+    REQUIRE( 4 == jobs.getWorkerCount() );
+
+    std::atomic<uint32_t> sum { 0 };
+    Lore::JobSystem::Counter counter;
+    for ( uint32_t i = 0; i < jobCount; ++i ) {
+      jobs.run( [&sum, i] {
+        sum.fetch_add( i, std::memory_order_relaxed );
+      }, counter );
+    }
+    jobs.wait( counter );
+
+    REQUIRE( counter.done() );
+    REQUIRE( ( jobCount * ( jobCount - 1 ) ) / 2 == sum.load() );
+  }
+
+  SECTION( "Child jobs" )
+  {
+    Lore::JobSystem jobs( 2 );
+
+    // Each parent spawns children on its own counter and waits on them,
+    // which must not starve the pool.
+    std::atomic<uint32_t> leaves { 0 };
+    Lore::JobSystem::Counter parents;
+    for ( uint32_t i = 0; i < 16; ++i ) {
+      jobs.run( [&jobs, &leaves] {
+        Lore::JobSystem::Counter children;
+        for ( uint32_t c = 0; c < 16; ++c ) {
+          jobs.run( [&leaves] {
+            leaves.fetch_add( 1, std::memory_order_relaxed );
+          }, children );
+        }
+        jobs.wait( children );
+      }, parents );
+    }
+    jobs.wait( parents );
+
+    REQUIRE( 16 * 16 == leaves.load() );
+  }
+
+  SECTION( "No workers" )
+  {
+    // Waiting threads run the jobs themselves.
+    Lore::JobSystem jobs( 0 );
+
+    uint32_t count = 0;
+    Lore::JobSystem::Counter counter;
+    for ( uint32_t i = 0; i < jobCount; ++i ) {
+      jobs.run( [&count] {
+        ++count;
+      }, counter );
+    }
+    jobs.wait( counter );
+
+    REQUIRE( jobCount == count );
+  }
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+TEST_CASE( "Parallel for", "[jobs]" )
+{
+  Lore::JobSystem jobs( 3 );
+
+  constexpr const size_t size = 10000;
+  std::vector<uint32_t> values( size, 0 );
+
+  SECTION( "Every index is visited exactly once" )
+  {
+    // Catch assertions are not thread-safe, so collect results for the main thread.
+    std::atomic<uint32_t> chunks { 0 };
+    std::atomic<uint32_t> oversized { 0 };
+    jobs.parallelFor( 0, size, 64, [&values, &chunks, &oversized] ( const size_t begin, const size_t end ) {
+      if ( end - begin > 64 ) {
+        oversized.fetch_add( 1, std::memory_order_relaxed );
+      }
+      for ( size_t i = begin; i < end; ++i ) {
+        ++values[i];
+      }
+      chunks.fetch_add( 1, std::memory_order_relaxed );
+    } );
+
+    REQUIRE( ( size + 63 ) / 64 == chunks.load() );
+    REQUIRE( 0 == oversized.load() );
+    for ( size_t i = 0; i < size; ++i ) {
+      REQUIRE( 1 == values[i] );
+    }
+  }
+
+  SECTION( "Small ranges run inline" )
+  {
+    const auto caller = std::this_thread::get_id();
+    std::thread::id ranOn {};
+    jobs.parallelFor( 0, 16, 64, [&ranOn] ( const size_t begin, const size_t end ) {
+      ranOn = std::this_thread::get_id();
+    } );
+
+    REQUIRE( caller == ranOn );
+  }
+
+  SECTION( "Exceptions reach the caller" )
+  {
+    REQUIRE_THROWS_AS( jobs.parallelFor( 0, size, 64, [] ( const size_t begin, const size_t ) {
+      if ( 640 == begin ) {
+        throw Lore::Exception( "Job failed" );
+      }
+    } ), Lore::Exception );
+
+    // Non-standard exception types must not take down a worker either.
+    REQUIRE_THROWS_AS( jobs.parallelFor( 0, size, 64, [] ( const size_t, const size_t ) {
+      throw 42;
+    } ), int );
+
+    // Workers are still alive and the pool is usable.
+    std::atomic<uint32_t> chunks { 0 };
+    jobs.parallelFor( 0, size, 64, [&chunks] ( const size_t, const size_t ) {
+      chunks.fetch_add( 1, std::memory_order_relaxed );
+    } );
+    REQUIRE( ( size + 63 ) / 64 == chunks.load() );
+  }
+
+  SECTION( "Empty range" )
+  {
+    bool called = false;
+    jobs.parallelFor( 8, 8, 1, [&called] ( const size_t, const size_t ) {
+      called = true;
+    } );
+
+    REQUIRE_FALSE( called );
+  }
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
@@ -0,0 +1,90 @@
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+// The MIT License (MIT)
+// This source file is part of LORE
+// ( Lightweight Object-oriented Rendering Engine )
+//
+// Copyright (c) 2017-2021 Jordan Sparks
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files ( the "Software" ), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+#include "catch.hpp"
+#include "TestUtils.h"
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+TEST_CASE( "Bounding volumes", "[math]" )
+{
+  SECTION( "Box merging" )
+  {
+    Lore::BoundingBox box;
+    REQUIRE( box.isEmpty() );
+
+    box.merge( glm::vec3( 1.f, 2.f, 3.f ) );
+    box.merge( glm::vec3( -1.f, 0.f, 5.f ) );
+    REQUIRE_FALSE( box.isEmpty() );
+    REQUIRE( box.min == glm::vec3( -1.f, 0.f, 3.f ) );
+    REQUIRE( box.max == glm::vec3( 1.f, 2.f, 5.f ) );
+
+    // Empty boxes don't contribute.
+    box.merge( Lore::BoundingBox() );
+    REQUIRE( box.min == glm::vec3( -1.f, 0.f, 3.f ) );
+  }
+
+  SECTION( "Box transform" )
+  {
+    const Lore::BoundingBox box( glm::vec3( -0.5f ), glm::vec3( 0.5f ) );
+
+    // Rotating a unit cube 45 degrees about y widens it on x and z only.
+    glm::mat4 m = glm::translate( glm::mat4( 1.f ), glm::vec3( 10.f, 0.f, 0.f ) );
+    m = glm::rotate( m, glm::radians( 45.f ), Lore::Vec3PosY );
+    m = glm::scale( m, glm::vec3( 2.f ) );
+
+    const Lore::BoundingBox result = box.transform( m );
+    const float halfDiagonal = std::sqrt( 2.f );
+    REQUIRE( result.min.x == Approx( 10.f - halfDiagonal ) );
+    REQUIRE( result.max.x == Approx( 10.f + halfDiagonal ) );
+    REQUIRE( result.min.y == Approx( -1.f ) );
+    REQUIRE( result.max.y == Approx( 1.f ) );
+    REQUIRE( result.min.z == Approx( -halfDiagonal ) );
+    REQUIRE( result.max.z == Approx( halfDiagonal ) );
+
+    REQUIRE( Lore::BoundingBox().transform( m ).isEmpty() );
+  }
+
+  SECTION( "Sphere merging" )
+  {
+    Lore::BoundingSphere sphere;
+    REQUIRE( sphere.isEmpty() );
+
+    sphere.merge( Lore::BoundingSphere( glm::vec3( 0.f ), 1.f ) );
+    sphere.merge( Lore::BoundingSphere( glm::vec3( 4.f, 0.f, 0.f ), 1.f ) );
+    REQUIRE( sphere.center.x == Approx( 2.f ) );
+    REQUIRE( sphere.radius == Approx( 3.f ) );
+
+    // Already enclosed.
+    sphere.merge( Lore::BoundingSphere( glm::vec3( 2.f, 0.f, 0.f ), 0.5f ) );
+    REQUIRE( sphere.radius == Approx( 3.f ) );
+
+    REQUIRE_FALSE( sphere.intersects( Lore::BoundingBox( glm::vec3( 4.5f ), glm::vec3( 6.f ) ) ) );
+    REQUIRE( sphere.intersects( Lore::BoundingBox( glm::vec3( 4.5f, -1.f, -1.f ), glm::vec3( 6.f, 1.f, 1.f ) ) ) );
+  }
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
@@ -0,0 +1,63 @@
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+// The MIT License (MIT)
+// This source file is part of LORE
+// ( Lightweight Object-oriented Rendering Engine )
+//
+// Copyright (c) 2017-2021 Jordan Sparks
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files ( the "Software" ), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+#include "catch.hpp"
+#include "TestUtils.h"
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+TEST_CASE( "Frustum culling", "[math]" )
+{
+  SECTION( "Clip space" )
+  {
+    // An identity view-projection leaves the [-1, 1] cube as the frustum.
+    const Lore::Frustum frustum( glm::mat4( 1.f ) );
+
+    REQUIRE( frustum.intersectsSphere( glm::vec3( 0.f ), 0.1f ) );
+    REQUIRE_FALSE( frustum.intersectsSphere( glm::vec3( 3.f, 0.f, 0.f ), 1.f ) );
+    REQUIRE( frustum.intersectsSphere( glm::vec3( 3.f, 0.f, 0.f ), 2.5f ) );
+
+    REQUIRE( frustum.intersectsAABB( glm::vec3( 0.5f ), glm::vec3( 2.f ) ) );
+    REQUIRE_FALSE( frustum.intersectsAABB( glm::vec3( 1.5f, -1.f, -1.f ), glm::vec3( 2.f, 1.f, 1.f ) ) );
+  }
+
+  SECTION( "Perspective" )
+  {
+    // Camera at the origin looking down -z.
+    const glm::mat4 projection = glm::perspective( glm::radians( 45.f ), 16.f / 9.f, 0.1f, 100.f );
+    const Lore::Frustum frustum( projection );
+
+    REQUIRE( frustum.intersectsSphere( glm::vec3( 0.f, 0.f, -10.f ), 1.f ) );
+    REQUIRE_FALSE( frustum.intersectsSphere( glm::vec3( 0.f, 0.f, 10.f ), 1.f ) );
+    REQUIRE_FALSE( frustum.intersectsSphere( glm::vec3( 0.f, 0.f, -200.f ), 1.f ) );
+    REQUIRE_FALSE( frustum.intersectsSphere( glm::vec3( 50.f, 0.f, -10.f ), 1.f ) );
+
+    REQUIRE( frustum.intersectsAABB( glm::vec3( -1.f, -1.f, -11.f ), glm::vec3( 1.f, 1.f, -9.f ) ) );
+    REQUIRE_FALSE( frustum.intersectsAABB( glm::vec3( -1.f, -1.f, 5.f ), glm::vec3( 1.f, 1.f, 9.f ) ) );
+  }
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
@@ -39,22 +39,33 @@ TEST_CASE( "Memory Pool", "[memory]" )
     std::vector<Lore::Node*> nodes;
     for ( int i = 0; i < size; ++i ) {
       nodes.push_back( pool.create() );
-      REQUIRE( true == nodes[i]->inUse );
+      REQUIRE( pool.isActive( nodes[i] ) );
       nodes.back()->setPosition( 1.f, 1.f );
       nodes.back()->createSpriteController();
     }
 
     auto nodeToDestroy = nodes[50];
     pool.destroy( nodeToDestroy );
-    REQUIRE( false == nodeToDestroy->inUse );
-    REQUIRE( 0.f == nodeToDestroy->getPosition().x );
-    REQUIRE( 0.f == nodeToDestroy->getPosition().y );
-    REQUIRE_FALSE( nodeToDestroy->getSpriteController() );
+    REQUIRE_FALSE( pool.isActive( nodeToDestroy ) );
+    REQUIRE_FALSE( pool.getObjectAt( 50 ) );
+
+    // The freed slot is reused and the object is freshly constructed.
+    auto recycled = pool.create();
+    REQUIRE( recycled == nodeToDestroy );
+    REQUIRE( pool.isActive( recycled ) );
+    REQUIRE( 0.f == recycled->getPosition().x );
+    REQUIRE( 0.f == recycled->getPosition().y );
+    REQUIRE_FALSE( recycled->getSpriteController() );
 
     pool.destroyAll();
+    REQUIRE( pool.getActiveObjectCount() == 0 );
+    for ( int i = 0; i < size; ++i ) {
+      REQUIRE_FALSE( pool.getObjectAt( i ) );
+    }
+
     for ( int i = 0; i < size; ++i ) {
-      auto node = pool.getObjectAt( i );
-      REQUIRE( false == node->inUse );
+      auto node = pool.create();
+      REQUIRE( pool.isActive( node ) );
       REQUIRE( 0.f == node->getPosition().x );
       REQUIRE( 0.f == node->getPosition().y );
       REQUIRE_FALSE( node->getSpriteController() );
@@ -107,14 +118,14 @@ TEST_CASE( "Pool Cluster", "[memory]" )
       nodes.push_back( cluster.create<Lore::Node>() );
       materials.push_back( cluster.create<Lore::Material>() );
 
-      REQUIRE( true == nodes[i]->inUse );
-      REQUIRE( true == materials[i]->inUse );
+      REQUIRE( cluster.isActive<Lore::Node>( nodes[i] ) );
+      REQUIRE( cluster.isActive<Lore::Material>( materials[i] ) );
     }
 
     cluster.destroy<Lore::Node>( nodes[100] );
     cluster.destroy<Lore::Material>( materials[100] );
-    REQUIRE( false == nodes[100]->inUse );
-    REQUIRE( false == materials[100]->inUse );
+    REQUIRE_FALSE( cluster.isActive<Lore::Node>( nodes[100] ) );
+    REQUIRE_FALSE( cluster.isActive<Lore::Material>( materials[100] ) );
   }
 
   cluster.unregisterPool<Lore::Node>();
@@ -122,3 +133,422 @@ TEST_CASE( "Pool Cluster", "[memory]" )
 }
 
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+namespace {
+
+  // Stands in for a render plugin's implementation of an interface type.
+  class DerivedNode : public Lore::Node
+  { };
+
+}
+
+TEST_CASE( "Derived pool config", "[memory]" )
+{
+  Lore::PoolCluster cluster( "derived" );
+
+  // Configuration uses the interface name, as does the pool itself.
+  Lore::PoolConfig config;
+  config.size = 8;
+  cluster.setPoolConfig( "Node", config );
+  cluster.registerPool<Lore::Node, DerivedNode>( 128 );
+
+  const auto stats = cluster.getPoolStats<Lore::Node>();
+  REQUIRE( "Node" == stats.name );
+  REQUIRE( 8 == stats.totalObjects );
+
+  cluster.unregisterPool<Lore::Node>();
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+TEST_CASE( "Pool growth", "[memory]" )
+{
+  constexpr const size_t size = 16;
+
+  SECTION( "Linear growth keeps existing addresses" )
+  {
+    Lore::MemoryPool<Lore::Prefab> pool( "test", size );
+
+    std::vector<Lore::Prefab*> prefabs;
+    for ( size_t i = 0; i < size * 3; ++i ) {
+      prefabs.push_back( pool.create() );
+    }
+
+    REQUIRE( pool.getTotalObjectCount() == size * 3 );
+    REQUIRE( pool.getSlabCount() == 3 );
+    REQUIRE( pool.getActiveObjectCount() == size * 3 );
+    for ( const auto prefab : prefabs ) {
+      REQUIRE( pool.isActive( prefab ) );
+    }
+  }
+
+  SECTION( "Objects are constructed lazily" )
+  {
+    Lore::MemoryPool<Lore::Prefab> pool( "test", size );
+    REQUIRE( pool.getActiveObjectCount() == 0 );
+    REQUIRE_FALSE( pool.getObjectAt( 0 ) );
+
+    auto prefab = pool.create();
+    REQUIRE( pool.getObjectAt( 0 ) == prefab );
+    REQUIRE( pool.isActive( prefab ) );
+  }
+
+  SECTION( "Fixed pools throw at capacity" )
+  {
+    Lore::PoolGrowthPolicy policy;
+    policy.mode = Lore::PoolGrowthPolicy::Mode::Fixed;
+    Lore::MemoryPool<Lore::Prefab> pool( "test", size, policy );
+
+    for ( size_t i = 0; i < size; ++i ) {
+      pool.create();
+    }
+    REQUIRE_THROWS_AS( pool.create(), Lore::MemoryException );
+
+    pool.resize( size * 2 );
+    REQUIRE( pool.getTotalObjectCount() == size * 2 );
+    REQUIRE( pool.create() );
+  }
+
+  SECTION( "Maximum capacity is respected" )
+  {
+    Lore::PoolGrowthPolicy policy;
+    policy.mode = Lore::PoolGrowthPolicy::Mode::Doubling;
+    policy.maxSize = size * 3;
+    Lore::MemoryPool<Lore::Prefab> pool( "test", size, policy );
+
+    for ( size_t i = 0; i < size * 3; ++i ) {
+      pool.create();
+    }
+    REQUIRE( pool.getTotalObjectCount() == size * 3 );
+    REQUIRE_THROWS_AS( pool.create(), Lore::MemoryException );
+  }
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+TEST_CASE( "Pool Cluster resize", "[memory]" )
+{
+  Lore::PoolCluster cluster( "test" );
+  cluster.registerPool<Lore::Material>( 4 );
+  cluster.resizePool<Lore::Material>( 64 );
+
+  Lore::PoolGrowthPolicy policy;
+  policy.mode = Lore::PoolGrowthPolicy::Mode::Fixed;
+  cluster.setPoolGrowthPolicy<Lore::Material>( policy );
+
+  for ( int i = 0; i < 64; ++i ) {
+    REQUIRE( cluster.create<Lore::Material>() );
+  }
+  REQUIRE_THROWS_AS( cluster.create<Lore::Material>(), Lore::MemoryException );
+
+  cluster.unregisterPool<Lore::Material>();
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+TEST_CASE( "Pool storage and iteration", "[memory]" )
+{
+  constexpr const size_t size = 32;
+  Lore::MemoryPool<Lore::Node> pool( "test", size );
+
+  std::vector<Lore::Node*> nodes;
+  for ( size_t i = 0; i < size; ++i ) {
+    nodes.push_back( pool.create() );
+  }
+
+  // Objects within a slab are laid out contiguously with a constant stride.
+  auto first = reinterpret_cast<uintptr_t>( pool.getObjectAt( 0 ) );
+  auto stride = reinterpret_cast<uintptr_t>( pool.getObjectAt( 1 ) ) - first;
+  REQUIRE( stride >= sizeof( Lore::Node ) );
+  for ( size_t i = 1; i < size; ++i ) {
+    REQUIRE( reinterpret_cast<uintptr_t>( pool.getObjectAt( i ) ) == first + stride * i );
+  }
+  pool.destroy( nodes[4] );
+  pool.destroy( nodes[9] );
+
+  size_t count = 0;
+  Lore::Node* previous = nullptr;
+  pool.forEachActive( [&] ( Lore::Node* node ) {
+    REQUIRE( pool.isActive( node ) );
+    REQUIRE( node > previous );
+    previous = node;
+    ++count;
+  } );
+  REQUIRE( count == size - 2 );
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+TEST_CASE( "Concurrent pool", "[memory]" )
+{
+  constexpr const size_t size = 64;
+  constexpr const size_t threadCount = 4;
+  constexpr const size_t objectsPerThread = 256;
+
+  Lore::PoolCluster cluster( "test" );
+  cluster.registerPool<Lore::Node>( size, Lore::PoolGrowthPolicy(), Lore::PoolThreading::Concurrent );
+
+  // Catch assertions are not thread-safe, so collect results for the main thread.
+  std::vector<std::vector<Lore::NodePtr>> created( threadCount );
+  std::vector<std::thread> workers;
+  for ( size_t t = 0; t < threadCount; ++t ) {
+    workers.emplace_back( [&cluster, &created, t] {
+      for ( size_t i = 0; i < objectsPerThread; ++i ) {
+        auto node = cluster.create<Lore::Node>();
+        node->setPosition( static_cast<Lore::real>( t ), static_cast<Lore::real>( i ) );
+        created[t].push_back( node );
+
+        // Churn the free list from several threads at once.
+        cluster.destroy<Lore::Node>( cluster.create<Lore::Node>() );
+      }
+    } );
+  }
+
+  for ( auto& worker : workers ) {
+    worker.join();
+  }
+
+  std::set<Lore::NodePtr> unique;
+  for ( size_t t = 0; t < threadCount; ++t ) {
+    REQUIRE( created[t].size() == objectsPerThread );
+    for ( size_t i = 0; i < objectsPerThread; ++i ) {
+      const auto node = created[t][i];
+      REQUIRE( cluster.isActive<Lore::Node>( node ) );
+      REQUIRE( static_cast<Lore::real>( t ) == node->getPosition().x );
+      REQUIRE( static_cast<Lore::real>( i ) == node->getPosition().y );
+      unique.insert( node );
+    }
+  }
+  REQUIRE( unique.size() == threadCount * objectsPerThread );
+
+  cluster.unregisterPool<Lore::Node>();
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+TEST_CASE( "Pool handles", "[memory]" )
+{
+  constexpr const size_t size = 8;
+
+  SECTION( "Stale handles do not resolve to reused slots" )
+  {
+    Lore::MemoryPool<Lore::Prefab> pool( "test", size );
+
+    auto prefab = pool.create();
+    auto handle = pool.getHandle( prefab );
+    REQUIRE_FALSE( handle.isNull() );
+    REQUIRE( pool.resolve( handle ) == prefab );
+
+    pool.destroy( prefab );
+    REQUIRE_FALSE( pool.isValid( handle ) );
+
+    // The free list hands back the same slot, which the old handle must not reach.
+    auto reused = pool.create();
+    REQUIRE( reused == prefab );
+    REQUIRE_FALSE( pool.isValid( handle ) );
+    REQUIRE( pool.getHandle( reused ) != handle );
+    REQUIRE( pool.resolve( pool.getHandle( reused ) ) == reused );
+  }
+
+  SECTION( "Handles resolve across slabs" )
+  {
+    Lore::MemoryPool<Lore::Prefab> pool( "test", size );
+
+    std::vector<Lore::PrefabHandle> handles;
+    for ( size_t i = 0; i < size * 4; ++i ) {
+      handles.push_back( pool.getHandle( pool.create() ) );
+    }
+    REQUIRE( pool.getSlabCount() == 4 );
+    for ( const auto& handle : handles ) {
+      REQUIRE( pool.isValid( handle ) );
+    }
+
+    pool.destroy( handles.back() );
+    REQUIRE_FALSE( pool.isValid( handles.back() ) );
+    REQUIRE( pool.getActiveObjectCount() == size * 4 - 1 );
+  }
+
+  SECTION( "Null handles never resolve" )
+  {
+    Lore::MemoryPool<Lore::Prefab> pool( "test", size );
+    REQUIRE_FALSE( pool.isValid( Lore::PrefabHandle() ) );
+
+    // An unused slot with a matching generation is still not a live object.
+    REQUIRE_FALSE( pool.isValid( Lore::PrefabHandle( 0, 0 ) ) );
+  }
+
+  SECTION( "Pool Cluster handles" )
+  {
+    Lore::PoolCluster cluster( "test" );
+    cluster.registerPool<Lore::Node>( size );
+
+    auto node = cluster.create<Lore::Node>();
+    Lore::NodeHandle handle = cluster.getHandle( node );
+    REQUIRE( cluster.resolve( handle ) == node );
+
+    cluster.destroy( handle );
+    REQUIRE_FALSE( cluster.isValid( handle ) );
+    REQUIRE_FALSE( cluster.resolve( handle ) );
+
+    cluster.unregisterPool<Lore::Node>();
+  }
+
+  SECTION( "Registry of handles" )
+  {
+    Lore::PoolCluster cluster( "test" );
+    cluster.registerPool<Lore::Prefab>( size );
+
+    Lore::Registry<std::map, Lore::PrefabHandle> registry;
+    auto prefab = cluster.create<Lore::Prefab>();
+    registry.insert( "prefab", cluster.getHandle( prefab ) );
+    REQUIRE( cluster.resolve( registry.get( "prefab" ) ) == prefab );
+
+    cluster.destroy<Lore::Prefab>( prefab );
+    REQUIRE_FALSE( cluster.resolve( registry.get( "prefab" ) ) );
+
+    cluster.unregisterPool<Lore::Prefab>();
+  }
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+TEST_CASE( "Pool Cluster type slots", "[memory]" )
+{
+  Lore::PoolCluster first( "first" );
+  Lore::PoolCluster second( "second" );
+
+  // Slots are process-wide, so clusters agree on them regardless of registration order.
+  first.registerPool<Lore::Node>( 8 );
+  first.registerPool<Lore::Material>( 8 );
+  second.registerPool<Lore::Material>( 8 );
+
+  REQUIRE( Lore::PoolSlot<Lore::Node>::Get() != Lore::PoolSlot<Lore::Material>::Get() );
+  REQUIRE( first.poolExists<Lore::Node>() );
+  REQUIRE( first.poolExists<Lore::Material>() );
+  REQUIRE_FALSE( second.poolExists<Lore::Node>() );
+  REQUIRE( second.poolExists<Lore::Material>() );
+
+  first.unregisterPool<Lore::Node>();
+  REQUIRE_FALSE( first.poolExists<Lore::Node>() );
+  REQUIRE( first.poolExists<Lore::Material>() );
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+TEST_CASE( "Pool stats", "[memory]" )
+{
+  Lore::PoolCluster cluster( "stats" );
+
+  // Overrides are matched by type name and applied at registration.
+  Lore::PoolConfig config;
+  config.size = 4;
+  config.growthPolicy.mode = Lore::PoolGrowthPolicy::Mode::Fixed;
+  config.overrideGrowthPolicy = true;
+  cluster.setPoolConfig( "Material", config );
+  cluster.registerPool<Lore::Material>( 128 );
+
+  std::vector<Lore::Material*> materials;
+  for ( int i = 0; i < 4; ++i ) {
+    materials.push_back( cluster.create<Lore::Material>() );
+  }
+  REQUIRE_THROWS_AS( cluster.create<Lore::Material>(), Lore::MemoryException );
+
+  cluster.destroy<Lore::Material>( materials[0] );
+  cluster.destroy<Lore::Material>( materials[1] );
+
+  const auto stats = cluster.getPoolStats<Lore::Material>();
+  REQUIRE( "Material" == stats.name );
+  REQUIRE( 4 == stats.totalObjects );
+  REQUIRE( 2 == stats.activeObjects );
+  REQUIRE( 4 == stats.highWaterMark );
+  REQUIRE( 4 == stats.allocations );
+  REQUIRE( 2 == stats.deallocations );
+  REQUIRE( 1 == stats.failures );
+  REQUIRE( 1 == stats.slabs );
+  REQUIRE( 2 * sizeof( Lore::Material ) == stats.liveBytes );
+  REQUIRE( stats.reservedBytes >= 4 * sizeof( Lore::Material ) );
+
+  REQUIRE( 1 == cluster.getAllPoolStats().size() );
+
+  cluster.unregisterPool<Lore::Material>();
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+TEST_CASE( "Frame arena", "[memory]" )
+{
+  Lore::FrameArena arena( 4096 );
+
+  SECTION( "Allocations are aligned and bump linearly" )
+  {
+    auto a = static_cast<unsigned char*>( arena.allocate( 3, 1 ) );
+    auto b = static_cast<unsigned char*>( arena.allocate( 16, 16 ) );
+    REQUIRE( 0 == reinterpret_cast<uintptr_t>( b ) % 16 );
+    REQUIRE( b > a );
+    REQUIRE( arena.getUsedBytes() >= 19 );
+
+    arena.reset();
+    REQUIRE( 0 == arena.getUsedBytes() );
+    REQUIRE( arena.allocate( 3, 1 ) == a );
+  }
+
+  SECTION( "Overflowing frames are coalesced on reset" )
+  {
+    for ( int frame = 0; frame < 3; ++frame ) {
+      // Containers must be gone before the arena is reset.
+      {
+        Lore::FrameVector<Lore::NodePtr> nodes { Lore::FrameAllocator<Lore::NodePtr>( &arena ) };
+        for ( size_t i = 0; i < 4096; ++i ) {
+          nodes.push_back( nullptr );
+        }
+
+        Lore::FrameMultiMap<Lore::real, size_t> sorted { Lore::FrameAllocator<std::pair<const Lore::real, size_t>>( &arena ) };
+        for ( size_t i = 0; i < 256; ++i ) {
+          sorted.insert( { static_cast<Lore::real>( 256 - i ), i } );
+        }
+        REQUIRE( sorted.begin()->second == 255 );
+      }
+
+      arena.reset();
+    }
+
+    // After the first frame the arena settles into a single block.
+    REQUIRE( 1 == arena.getBlockCount() );
+    REQUIRE( arena.getCapacity() >= arena.getHighWaterMark() );
+  }
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+TEST_CASE( "Pool Cluster create/destroy churn", "[.][benchmark][memory]" )
+{
+  constexpr const size_t iterations = 1000000;
+
+  Lore::PoolCluster cluster( "benchmark" );
+  cluster.registerPool<Lore::Material>( 1024 );
+
+  // Equivalent of the previous type_index keyed pool table, for comparison.
+  std::unordered_map<std::type_index, std::unique_ptr<Lore::MemoryPoolBase>> table;
+  table[std::type_index( typeid( Lore::Material ) )] = std::make_unique<Lore::MemoryPool<Lore::Material>>( "benchmark", 1024 );
+  auto lookup = [&table] {
+    return static_cast< Lore::MemoryPool<Lore::Material>* >( table.find( std::type_index( typeid( Lore::Material ) ) )->second.get() );
+  };
+
+  BENCHMARK( "Slot indexed PoolCluster" )
+  {
+    for ( size_t i = 0; i < iterations; ++i ) {
+      cluster.destroy<Lore::Material>( cluster.create<Lore::Material>() );
+    }
+  }
+
+  BENCHMARK( "type_index hash table" )
+  {
+    for ( size_t i = 0; i < iterations; ++i ) {
+      lookup()->destroy( lookup()->create() );
+    }
+  }
+
+  cluster.unregisterPool<Lore::Material>();
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
@@ -24,6 +24,211 @@
 // THE SOFTWARE.
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
 
-// Test iterators...
+#include "catch.hpp"
+
+using Lore::operator "" _sid;
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+TEST_CASE( "String ids", "[registry]" )
+{
+  static_assert( "Core"_sid == Lore::StringId( "core" ), "Literal ids must be case-insensitive" );
+
+  REQUIRE( Lore::StringId( Lore::string( "TexturedQuad" ) ) == Lore::StringId( "texturedquad" ) );
+  REQUIRE( Lore::StringId( "TexturedQuad" ) != Lore::StringId( "TexturedQuad3D" ) );
+
+  const auto id = Lore::StringId::Intern( "InternedName" );
+  REQUIRE( "InternedName" == id.getName() );
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+TEST_CASE( "Registry lookups", "[registry]" )
+{
+  Lore::MemoryPool<Lore::Node> pool( "test", 4 );
+  Lore::Registry<std::unordered_map, Lore::Node> registry;
+
+  auto first = pool.create();
+  auto second = pool.create();
+  registry.insert( "MainFloor", first );
+
+  REQUIRE( first == registry.get( "mainfloor" ) );
+  REQUIRE( registry.exists( "MAINFLOOR"_sid ) );
+  REQUIRE_THROWS_AS( registry.insert( "mainFloor", second ), Lore::Exception );
+  REQUIRE_THROWS_AS( registry.get( "Missing" ), Lore::ItemIdentityException );
+
+  // Duplicates get a numbered name.
+  registry.insert( "MainFloor", second, true );
+  REQUIRE( second == registry.get( "MainFloor1" ) );
+
+  registry.remove( "MainFloor" );
+  REQUIRE_FALSE( registry.exists( "MainFloor" ) );
+  REQUIRE( 1 == registry.size() );
+
+  pool.destroyAll();
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+TEST_CASE( "Flat registry", "[registry]" )
+{
+  Lore::MemoryPool<Lore::Node> pool( "test", 16 );
+  Lore::Registry<Lore::FlatMap, Lore::Node, Lore::InlineCapacity<2>> registry;
+
+  // Grow past the inline storage, entries stay sorted and reachable.
+  std::vector<Lore::Node*> nodes;
+  for ( int i = 0; i < 16; ++i ) {
+    nodes.push_back( pool.create() );
+    registry.insert( "Node" + std::to_string( i ), nodes.back() );
+  }
+
+  REQUIRE( 16 == registry.size() );
+  for ( int i = 0; i < 16; ++i ) {
+    REQUIRE( nodes[i] == registry.get( "node" + std::to_string( i ) ) );
+  }
+
+  auto copy = registry.clone();
+  registry.remove( "Node0" );
+  REQUIRE_FALSE( registry.exists( "Node0" ) );
+  REQUIRE( copy.exists( "Node0" ) );
+
+  Lore::StringId previous;
+  auto it = copy.getConstIterator();
+  while ( it.hasMore() ) {
+    REQUIRE_FALSE( it.peekNextKey() < previous );
+    previous = it.peekNextKey();
+    it.moveNext();
+  }
+
+  pool.destroyAll();
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+TEST_CASE( "Flat registry batches", "[registry]" )
+{
+  Lore::MemoryPool<Lore::Node> pool( "test", 32 );
+  Lore::Registry<Lore::FlatMap, Lore::Node, Lore::InlineCapacity<2>> registry;
+  registry.insert( "Node5", pool.create() );
+
+  std::vector<std::pair<Lore::StringId, Lore::Node*>> batch;
+  for ( int i = 0; i < 5; ++i ) {
+    batch.emplace_back( Lore::StringId( "Node" + std::to_string( i ) ), pool.create() );
+  }
+  registry.insert( batch.begin(), batch.end() );
+  REQUIRE( 6 == registry.size() );
+  for ( const auto& entry : batch ) {
+    REQUIRE( entry.second == registry.get( entry.first ) );
+  }
+
+  // A clash anywhere in the batch leaves the registry untouched.
+  batch.clear();
+  batch.emplace_back( Lore::StringId( "Node6" ), pool.create() );
+  batch.emplace_back( Lore::StringId( "Node3" ), pool.create() );
+  REQUIRE_THROWS( registry.insert( batch.begin(), batch.end() ) );
+  REQUIRE( 6 == registry.size() );
+  REQUIRE_FALSE( registry.exists( "Node6" ) );
+
+  const auto keep = registry.get( "Node2" );
+  REQUIRE( 5 == registry.removeIf( [keep] ( const Lore::Node* node ) { return node != keep; } ) );
+  REQUIRE( 1 == registry.size() );
+  REQUIRE( registry.exists( "Node2" ) );
+
+  pool.destroyAll();
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+TEST_CASE( "Safe registry", "[registry]" )
+{
+  Lore::MemoryPool<Lore::Node> pool( "test", 64 );
+  Lore::SafeRegistry<Lore::Node> registry;
+
+  std::vector<Lore::Node*> nodes;
+  for ( int i = 0; i < 64; ++i ) {
+    nodes.push_back( pool.create() );
+  }
+
+  SECTION( "Readers see consistent snapshots while a writer inserts" )
+  {
+    // Catch assertions are not thread-safe, the reader only records failures.
+    std::atomic<bool> done { false };
+    std::atomic<bool> consistent { true };
+    std::thread reader( [&] {
+      while ( !done ) {
+        size_t count = 0;
+        auto it = registry.getConstIterator();
+        while ( it.hasMore() ) {
+          if ( !it.getNext() ) {
+            consistent = false;
+          }
+          ++count;
+        }
+        if ( count > 64 ) {
+          consistent = false;
+        }
+      }
+    } );
+
+    for ( int i = 0; i < 64; ++i ) {
+      registry.insert( "Node" + std::to_string( i ), nodes[i] );
+    }
+
+    done = true;
+    reader.join();
+    REQUIRE( consistent );
+    REQUIRE( 64 == registry.size() );
+  }
+
+  SECTION( "Iterators keep their snapshot" )
+  {
+    for ( int i = 0; i < 8; ++i ) {
+      registry.insert( "Node" + std::to_string( i ), nodes[i] );
+    }
+
+    auto it = registry.getConstIterator();
+    registry.remove( "Node0" );
+    registry.clear();
+    REQUIRE( registry.empty() );
+
+    size_t count = 0;
+    while ( it.hasMore() ) {
+      it.getNext();
+      ++count;
+    }
+    REQUIRE( 8 == count );
+  }
+
+  SECTION( "Batches and growth" )
+  {
+    std::vector<std::pair<Lore::ID, Lore::Node*>> batch;
+    for ( int i = 0; i < 64; ++i ) {
+      batch.emplace_back( Lore::ID( "Node" + std::to_string( i ) ), nodes[i] );
+    }
+    registry.insert( "Node63", nodes[63] );
+    REQUIRE_THROWS_AS( registry.insert( batch.begin(), batch.end() ), Lore::Exception );
+    REQUIRE( 1 == registry.size() );
+
+    registry.remove( "Node63" );
+    registry.insert( batch.begin(), batch.end() );
+    REQUIRE( 64 == registry.size() );
+    for ( int i = 0; i < 64; ++i ) {
+      REQUIRE( nodes[i] == registry.get( "node" + std::to_string( i ) ) );
+    }
+
+    std::vector<Lore::ID> ids { "Node0", "Node1", "Missing" };
+    registry.remove( ids.begin(), ids.end() );
+    REQUIRE( 62 == registry.size() );
+    REQUIRE_FALSE( registry.exists( "Node0" ) );
+
+    int created = 0;
+    auto create = [&] { ++created; return nodes[0]; };
+    REQUIRE( nodes[0] == registry.getOrInsert( "Node0", create ) );
+    REQUIRE( nodes[0] == registry.getOrInsert( "Node0", create ) );
+    REQUIRE( 1 == created );
+  }
+
+  pool.destroyAll();
+}
 
 // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
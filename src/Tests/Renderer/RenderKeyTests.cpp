@@ -0,0 +1,197 @@
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+// The MIT License (MIT)
+// This source file is part of LORE
+// ( Lightweight Object-oriented Rendering Engine )
+//
+// Copyright (c) 2017-2021 Jordan Sparks
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files ( the "Software" ), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+
+#include "catch.hpp"
+#include "TestUtils.h"
+
+#include <LORE/Renderer/RenderKey.h>
+
+#include <algorithm>
+#include <random>
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+namespace {
+
+  // Draw lists never dereference their items, so indices stand in for nodes.
+  Lore::NodePtr FakeNode( const size_t i )
+  {
+    return reinterpret_cast<Lore::NodePtr>( i + 1 );
+  }
+
+  void RequireSortedAndStable( const Lore::DrawList& list,
+                               std::vector<std::pair<uint64_t, size_t>> expected )
+  {
+    std::stable_sort( expected.begin(), expected.end(),
+                      [] ( const std::pair<uint64_t, size_t>& a, const std::pair<uint64_t, size_t>& b ) {
+                        return a.first < b.first;
+                      } );
+
+    REQUIRE( list.size() == expected.size() );
+    for ( size_t i = 0; i < list.size(); ++i ) {
+      REQUIRE( list.getKey( i ) == expected[i].first );
+      REQUIRE( list[i].second == FakeNode( expected[i].second ) );
+    }
+  }
+
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+TEST_CASE( "Render keys", "[renderer]" )
+{
+  SECTION( "Depth quantization keeps float order" )
+  {
+    const Lore::real depths[] = { -1000.f, -2.5f, -0.f, 0.f, 1e-6f, 0.5f, 2.f, 1000.f, 20000.f };
+    for ( size_t i = 1; i < sizeof( depths ) / sizeof( depths[0] ); ++i ) {
+      REQUIRE( Lore::RenderKey::QuantizeDepth( depths[i - 1] ) <= Lore::RenderKey::QuantizeDepth( depths[i] ) );
+    }
+  }
+
+  SECTION( "Opaque draws group by state, then front-to-back" )
+  {
+    int programA = 0, programB = 0, material = 0, model = 0;
+
+    const uint64_t nearA = Lore::RenderKey::Opaque( &programA, &material, &model, 1.f );
+    const uint64_t farA = Lore::RenderKey::Opaque( &programA, &material, &model, 50.f );
+    const uint64_t nearB = Lore::RenderKey::Opaque( &programB, &material, &model, 1.f );
+
+    REQUIRE( nearA < farA );
+    REQUIRE( ( nearA >> 20 ) == ( farA >> 20 ) );
+    REQUIRE( ( nearA >> 20 ) != ( nearB >> 20 ) );
+    REQUIRE( 0 == ( nearA & Lore::RenderKey::TranslucentBit ) );
+  }
+
+  SECTION( "Translucent draws go back-to-front after opaque ones" )
+  {
+    int programA = 0, programB = 0, material = 0, model = 0;
+
+    const uint64_t opaque = Lore::RenderKey::Opaque( &programA, &material, &model, 1000.f );
+    const uint64_t nearA = Lore::RenderKey::Translucent( &programA, &material, &model, 1.f );
+    const uint64_t farB = Lore::RenderKey::Translucent( &programB, &material, &model, 50.f );
+
+    REQUIRE( opaque < farB );
+    REQUIRE( farB < nearA );
+  }
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+TEST_CASE( "Draw list sorting", "[renderer]" )
+{
+  Lore::DrawList list;
+
+  std::mt19937_64 rng( 1234 );
+  std::vector<std::pair<uint64_t, size_t>> expected;
+
+  SECTION( "Empty" )
+  {
+    list.sort();
+    REQUIRE( list.empty() );
+    REQUIRE( 0 == list.getOpaqueCount() );
+  }
+
+  SECTION( "Small lists" )
+  {
+    for ( size_t i = 0; i < 20; ++i ) {
+      const uint64_t key = rng() % 5;
+      list.add( key, nullptr, FakeNode( i ) );
+      expected.emplace_back( key, i );
+    }
+
+    list.sort();
+    RequireSortedAndStable( list, expected );
+  }
+
+  SECTION( "Large lists" )
+  {
+    // Few distinct keys sharing most of their bits, so digit passes are
+    // skipped and equal keys are common.
+    for ( size_t i = 0; i < 5000; ++i ) {
+      uint64_t key = ( rng() % 16 ) << 40 | ( rng() % 300 );
+      if ( 0 == i % 3 ) {
+        key |= Lore::RenderKey::TranslucentBit;
+      }
+      list.add( key, nullptr, FakeNode( i ) );
+      expected.emplace_back( key, i );
+    }
+
+    list.sort();
+    RequireSortedAndStable( list, expected );
+
+    const size_t translucent = static_cast<size_t>( std::count_if( expected.begin(), expected.end(),
+                                                                   [] ( const std::pair<uint64_t, size_t>& e ) {
+                                                                     return 0 != ( e.first & Lore::RenderKey::TranslucentBit );
+                                                                   } ) );
+    REQUIRE( list.getOpaqueCount() == list.size() - translucent );
+
+    // Adding more draws after a sort keeps working.
+    list.add( 0, nullptr, FakeNode( expected.size() ) );
+    expected.emplace_back( 0, expected.size() );
+    list.sort();
+    RequireSortedAndStable( list, expected );
+  }
+
+  SECTION( "Full-width random keys" )
+  {
+    for ( size_t i = 0; i < 1000; ++i ) {
+      const uint64_t key = rng();
+      list.add( key, nullptr, FakeNode( i ) );
+      expected.emplace_back( key, i );
+    }
+
+    list.sort();
+    RequireSortedAndStable( list, expected );
+  }
+
+  SECTION( "Changed keys" )
+  {
+    for ( size_t i = 0; i < 200; ++i ) {
+      const uint64_t key = rng() % 8;
+      list.add( key, nullptr, FakeNode( i ) );
+      expected.emplace_back( key, i );
+    }
+    list.sort();
+
+    // Re-sorting after keys change keeps equal keys in the order added,
+    // not the order of the previous sort.
+    for ( size_t i = 0; i < expected.size(); i += 3 ) {
+      expected[i].first = rng() % 8;
+      list.setKey( static_cast<uint32_t>( i ), expected[i].first );
+    }
+    list.sort();
+    RequireSortedAndStable( list, expected );
+
+    list.setVisible( 5, false );
+    REQUIRE_FALSE( list.isItemVisible( 5 ) );
+    for ( size_t i = 0; i < list.size(); ++i ) {
+      REQUIRE( list.isVisible( i ) == ( list[i].second != FakeNode( 5 ) ) );
+    }
+  }
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
@@ -0,0 +1,364 @@
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+// The MIT License (MIT)
+// This source file is part of LORE
+// ( Lightweight Object-oriented Rendering Engine )
+//
+// Copyright (c) 2017-2021 Jordan Sparks
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files ( the "Software" ), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+#include "catch.hpp"
+#include "TestUtils.h"
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+TEST_CASE( "Bulk node creation and destruction", "[scene]" )
+{
+  LoreTestHelper helper;
+
+  auto scene = helper.getContext()->createScene( "bulk", Lore::RendererType::Forward2D );
+
+  auto group = scene->createNode( "Group" );
+  auto stones = scene->createNodes( 1000, group, "stone" );
+  auto rest = scene->createNodes( 10, nullptr, "rest" );
+
+  REQUIRE( stones.size() == 1000 );
+  REQUIRE( scene->getNode( "stone999" ) == stones.back() );
+  REQUIRE( scene->getNode( "rest0" ) == rest.front() );
+  REQUIRE( stones.front()->getParent() == group );
+  REQUIRE( rest.front()->getParent() == scene->getRootNode() );
+
+  // Taken names fail the whole batch.
+  REQUIRE_THROWS( scene->createNodes( 20, nullptr, "rest" ) );
+  REQUIRE_THROWS( scene->getNode( "rest15" ) );
+
+  group->setPosition( 1.f, 0.f, 0.f );
+  stones[7]->setPosition( 2.f, 0.f, 0.f );
+  scene->updateSceneGraph();
+  REQUIRE( stones[7]->getWorldPosition().x == Approx( 3.f ) );
+
+  SECTION( "Destroying a subtree" )
+  {
+    stones[7]->createChildNode( "Pebble" );
+    scene->destroySubtree( group );
+
+    REQUIRE_THROWS( scene->getNode( "Group" ) );
+    REQUIRE_THROWS( scene->getNode( "stone0" ) );
+    REQUIRE_THROWS( scene->getNode( "Pebble" ) );
+    REQUIRE( scene->getNode( "rest9" ) == rest.back() );
+
+    rest.back()->setPosition( 4.f, 0.f, 0.f );
+    scene->updateSceneGraph();
+    REQUIRE( rest.back()->getWorldPosition().x == Approx( 4.f ) );
+  }
+
+  SECTION( "Clearing the scene" )
+  {
+    scene->clear();
+
+    REQUIRE_THROWS( scene->getNode( "Group" ) );
+    REQUIRE_THROWS( scene->getNode( "rest0" ) );
+    scene->updateSceneGraph();
+
+    // Names are free again.
+    REQUIRE( scene->createNodes( 10, nullptr, "rest" ).size() == 10 );
+  }
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+TEST_CASE( "Node templates", "[scene]" )
+{
+  LoreTestHelper helper;
+
+  auto scene = helper.getContext()->createScene( "templates", Lore::RendererType::Forward2D );
+
+  auto tree = scene->createNode( "Tree" );
+  auto trunk = tree->createChildNode( "Trunk" );
+  auto leaves = trunk->createChildNode( "Leaves" );
+  tree->setScale( 2.f );
+  trunk->setPosition( 0.f, 1.f, 0.f );
+  leaves->setPosition( 0.f, 2.f, 0.f );
+  leaves->setDepth( 5.f );
+
+  const Lore::NodeTemplate treeTemplate( tree );
+  REQUIRE( treeTemplate.size() == 3 );
+
+  // The template is a snapshot, later changes don't affect it.
+  scene->destroySubtree( tree );
+
+  auto forest = scene->createNode( "Forest" );
+  forest->setPosition( 10.f, 0.f, 0.f );
+  auto trees = scene->instantiate( treeTemplate, 100, forest, "tree" );
+  REQUIRE( trees.size() == 100 );
+
+  REQUIRE( scene->getNode( "tree42" ) == trees[42] );
+  auto instanceLeaves = scene->getNode( "tree42_Trunk_Leaves" );
+  REQUIRE( instanceLeaves->getParent() == scene->getNode( "tree42_Trunk" ) );
+  REQUIRE( instanceLeaves->getParent()->getParent() == trees[42] );
+  REQUIRE( trees[42]->getParent() == forest );
+  REQUIRE( instanceLeaves->getDepth() == Approx( 5.f ) );
+
+  trees[42]->translate( 0.f, 0.f, 1.f );
+  scene->updateSceneGraph();
+  REQUIRE( instanceLeaves->getWorldPosition().x == Approx( 10.f ) );
+  REQUIRE( instanceLeaves->getWorldPosition().y == Approx( 3.f ) );
+  REQUIRE( instanceLeaves->getWorldPosition().z == Approx( 1.f ) );
+  REQUIRE( instanceLeaves->getDerivedScale().x == Approx( 2.f ) );
+
+  // Taken names fail the whole batch.
+  REQUIRE_THROWS( scene->instantiate( treeTemplate, 200, forest, "tree" ) );
+  REQUIRE_THROWS( scene->getNode( "tree150" ) );
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+TEST_CASE( "Render registry", "[scene]" )
+{
+  LoreTestHelper helper;
+
+  auto scene = helper.getContext()->createScene( "registry", Lore::RendererType::Forward2D );
+  Lore::RenderRegistry& registry = scene->getRenderRegistry();
+
+  auto prefab = Lore::Resource::CreatePrefab( "registryPrefab", Lore::Mesh::Type::TexturedQuad );
+  auto box = Lore::Resource::CreateBox( "registryBox" );
+
+  auto a = scene->createNode( "a" );
+  auto b = a->createChildNode( "b" );
+  auto empty = scene->createNode( "empty" );
+  scene->updateSceneGraph();
+  REQUIRE( registry.size() == 0 );
+
+  // Attachments are picked up on the next update.
+  a->attachObject( prefab );
+  b->attachObject( prefab );
+  b->attachObject( box );
+  REQUIRE( registry.size() == 0 );
+  scene->updateSceneGraph();
+  REQUIRE( registry.size() == 3 );
+
+  // Clones are drawn like everything they copied.
+  auto c = a->clone( "c" );
+  scene->updateSceneGraph();
+  REQUIRE( registry.size() == 4 );
+  REQUIRE( registry[3].node == c );
+  REQUIRE( registry[3].type == Lore::RenderRegistry::Entry::Type::Prefab );
+
+  a->detachObject( prefab );
+  scene->updateSceneGraph();
+  REQUIRE( registry.size() == 3 );
+  for ( size_t i = 0; i < registry.size(); ++i ) {
+    REQUIRE( registry[i].node != a );
+  }
+
+  // Destroying nodes drops their entries, empty nodes never had any.
+  scene->destroyNode( empty );
+  scene->updateSceneGraph();
+  REQUIRE( registry.size() == 3 );
+  scene->destroySubtree( a );
+  scene->updateSceneGraph();
+  REQUIRE( registry.size() == 1 );
+  REQUIRE( registry[0].node == c );
+
+  SECTION( "Static frames reuse cached keys" )
+  {
+    int renderer = 0;
+    const glm::mat4 view( 1.f );
+
+    REQUIRE( registry.setView( &renderer, view ) );
+    scene->updateSceneGraph();
+    REQUIRE( registry.getMoved().empty() );
+    REQUIRE_FALSE( registry.setView( &renderer, view ) );
+
+    // Moving a node only hands its draws back.
+    c->translate( 1.f, 0.f );
+    scene->updateSceneGraph();
+    REQUIRE( registry.getMoved().size() == 1 );
+    REQUIRE( registry[registry.getMoved()[0]].node == c );
+    REQUIRE_FALSE( registry.setView( &renderer, view ) );
+
+    // Another view, a missed update or a rebuild needs everything refreshed.
+    REQUIRE( registry.setView( &renderer, glm::mat4( 2.f ) ) );
+    scene->updateSceneGraph();
+    scene->updateSceneGraph();
+    REQUIRE( registry.setView( &renderer, glm::mat4( 2.f ) ) );
+    prefab->setRenderQueue( Lore::RenderQueue::Foreground );
+    scene->updateSceneGraph();
+    REQUIRE( registry.setView( &renderer, glm::mat4( 2.f ) ) );
+    REQUIRE( registry.getActiveQueues().size() == 1 );
+    const uint32_t foreground = Lore::RenderQueue::Foreground;
+    REQUIRE( registry.getActiveQueues()[0].first == foreground );
+  }
+
+  scene->clear();
+  scene->updateSceneGraph();
+  REQUIRE( registry.size() == 0 );
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+namespace {
+
+  using Renderable = std::pair<Lore::NodePtr, const void*>;
+
+  ///
+  /// \brief Collects renderables the way the scene graph used to be walked
+  ///     for submission: depth first, then each node's prefabs, boxes,
+  ///     textboxes and lights.
+  void CollectSerial( Lore::NodePtr node, std::vector<Renderable>& renderables )
+  {
+    auto prefabIt = node->getPrefabListConstIterator();
+    while ( prefabIt.hasMore() ) {
+      renderables.emplace_back( node, Lore::MemoryAccess::GetPrimaryPoolCluster()->resolve( prefabIt.getNext() ) );
+    }
+    auto boxIt = node->getBoxListConstIterator();
+    while ( boxIt.hasMore() ) {
+      renderables.emplace_back( node, boxIt.getNext() );
+    }
+    auto textboxIt = node->getTextboxListConstIterator();
+    while ( textboxIt.hasMore() ) {
+      renderables.emplace_back( node, textboxIt.getNext() );
+    }
+    auto lightIt = node->getLightListConstIterator();
+    while ( lightIt.hasMore() ) {
+      renderables.emplace_back( node, lightIt.getNext() );
+    }
+
+    auto childIt = node->getChildNodeIterator();
+    while ( childIt.hasMore() ) {
+      CollectSerial( childIt.getNext(), renderables );
+    }
+  }
+
+  const void* GetObject( const Lore::RenderRegistry::Entry& entry )
+  {
+    switch ( entry.type ) {
+    default:
+    case Lore::RenderRegistry::Entry::Type::Prefab:
+      return entry.prefab;
+    case Lore::RenderRegistry::Entry::Type::Box:
+      return entry.box;
+    case Lore::RenderRegistry::Entry::Type::Textbox:
+      return entry.textbox;
+    case Lore::RenderRegistry::Entry::Type::Light:
+      return entry.light;
+    }
+  }
+
+  void RequireSerialOrder( Lore::ScenePtr scene )
+  {
+    scene->updateSceneGraph();
+
+    std::vector<Renderable> expected;
+    CollectSerial( scene->getRootNode(), expected );
+
+    const Lore::RenderRegistry& registry = scene->getRenderRegistry();
+    REQUIRE( registry.size() == expected.size() );
+    for ( size_t i = 0; i < registry.size(); ++i ) {
+      REQUIRE( registry[i].node == expected[i].first );
+      REQUIRE( GetObject( registry[i] ) == expected[i].second );
+    }
+
+    // Draws and boxes reach their queue in the same order, so unsorted
+    // blended boxes overlap as they used to.
+    Lore::RenderQueue& queue = scene->getRenderRegistry().getQueue( Lore::RenderQueue::General );
+    size_t draw = 0, box = 0;
+    for ( size_t i = 0; i < registry.size(); ++i ) {
+      switch ( registry[i].type ) {
+      default:
+        break;
+
+      case Lore::RenderRegistry::Entry::Type::Prefab:
+        REQUIRE( draw < queue.draws.size() );
+        REQUIRE( queue.draws.getItem( static_cast<uint32_t>( draw ) ).second == registry[i].node );
+        ++draw;
+        break;
+
+      case Lore::RenderRegistry::Entry::Type::Box:
+        REQUIRE( box < queue.boxes.size() );
+        REQUIRE( queue.boxes[box].box == registry[i].box );
+        REQUIRE( queue.boxes[box].model == registry[i].node->getFullTransform() );
+        ++box;
+        break;
+      }
+    }
+    REQUIRE( draw == queue.draws.size() );
+    REQUIRE( box == queue.boxes.size() );
+  }
+
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+TEST_CASE( "Render registry matches the serial traversal", "[scene]" )
+{
+  LoreTestHelper helper;
+
+  auto scene = helper.getContext()->createScene( "registryOrder", Lore::RendererType::Forward2D );
+
+  auto prefabA = Lore::Resource::CreatePrefab( "orderPrefabA", Lore::Mesh::Type::TexturedQuad );
+  auto prefabB = Lore::Resource::CreatePrefab( "orderPrefabB", Lore::Mesh::Type::TexturedQuad );
+  auto light = scene->createPointLight( "orderLight" );
+
+  std::vector<Lore::BoxPtr> boxes;
+  for ( int i = 0; i < 6; ++i ) {
+    boxes.push_back( Lore::Resource::CreateBox( "orderBox" + std::to_string( i ) ) );
+  }
+
+  auto a = scene->createNode( "a" );
+  auto b = a->createChildNode( "b" );
+  auto c = scene->createNode( "c" );
+  auto d = b->createChildNode( "d" );
+
+  // Attach deepest and last nodes first, so attach order differs from the
+  // graph's.
+  d->attachObject( boxes[0] );
+  c->attachObject( prefabA );
+  c->attachObject( boxes[1] );
+  d->attachObject( prefabB );
+  a->attachObject( boxes[2] );
+  b->attachObject( light );
+  a->attachObject( prefabA );
+  b->attachObject( boxes[3] );
+  d->attachObject( boxes[4] );
+  RequireSerialOrder( scene );
+
+  // Detach from the middle of the lists.
+  a->detachObject( prefabA );
+  c->attachObject( boxes[5] );
+  RequireSerialOrder( scene );
+
+  // Moved subtrees are drawn at their new place in the graph.
+  b->detachFromParent();
+  c->attachChildNode( b );
+  RequireSerialOrder( scene );
+
+  // Moving nodes keeps the order and refreshes box transforms.
+  d->setPosition( 2.f, 3.f );
+  c->translate( 1.f, 1.f );
+  RequireSerialOrder( scene );
+
+  // Clones are added and destroyed subtrees dropped.
+  a->clone( "e" );
+  scene->destroySubtree( d );
+  RequireSerialOrder( scene );
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
@@ -0,0 +1,98 @@
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+// The MIT License (MIT)
+// This source file is part of LORE
+// ( Lightweight Object-oriented Rendering Engine )
+//
+// Copyright (c) 2017-2021 Jordan Sparks
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files ( the "Software" ), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+#include "catch.hpp"
+#include "TestUtils.h"
+
+#include <algorithm>
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+TEST_CASE( "Spatial hash", "[scene]" )
+{
+  LoreTestHelper helper;
+
+  auto scene = helper.getContext()->createScene( "hash", Lore::RendererType::Forward2D );
+
+  Lore::SpatialHash hash;
+  auto a = scene->createNode( "a" );
+  auto b = scene->createNode( "b" );
+  auto c = scene->createNode( "c" );
+  auto background = scene->createNode( "background" );
+
+  // a and b overlap across a cell boundary, c is on its own, and the
+  // background covers enough cells to skip the grid.
+  const auto pa = hash.insert( a, glm::vec2( 0.3f ), glm::vec2( 0.7f ) );
+  const auto pb = hash.insert( b, glm::vec2( 0.6f ), glm::vec2( 1.1f ) );
+  const auto pc = hash.insert( c, glm::vec2( 5.f ), glm::vec2( 5.2f ) );
+  hash.insert( background, glm::vec2( -10.f ), glm::vec2( 10.f, -9.f ) );
+
+  REQUIRE( hash.size() == 4 );
+
+  SECTION( "Pairs" )
+  {
+    auto pairs = hash.findPairs();
+    REQUIRE( pairs.size() == 1 );
+    REQUIRE( pairs[0] == Lore::SpatialHash::Pair( a, b ) );
+
+    // Moving c onto the background and a away keeps the order stable.
+    hash.update( pc, glm::vec2( 0.f, -9.5f ), glm::vec2( 0.2f, -9.3f ) );
+    hash.update( pa, glm::vec2( 3.f ), glm::vec2( 3.2f ) );
+    pairs = hash.findPairs();
+    REQUIRE( pairs.size() == 1 );
+    REQUIRE( pairs[0] == Lore::SpatialHash::Pair( c, background ) );
+
+    hash.remove( pc );
+    REQUIRE( hash.findPairs().empty() );
+  }
+
+  SECTION( "Queries" )
+  {
+    Lore::SpatialHash::NodeList results;
+    hash.query( glm::vec2( 0.f ), glm::vec2( 2.f ), results );
+    REQUIRE( results.size() == 2 );
+    REQUIRE( std::find( results.begin(), results.end(), a ) != results.end() );
+    REQUIRE( std::find( results.begin(), results.end(), b ) != results.end() );
+
+    results.clear();
+    hash.query( glm::vec2( 0.6f ), glm::vec2( 0.65f ), results, a );
+    REQUIRE( results.size() == 1 );
+    REQUIRE( results[0] == b );
+
+    // Touching edges count as overlapping, as with AABB::intersects().
+    results.clear();
+    hash.update( pb, glm::vec2( 0.7f, 0.3f ), glm::vec2( 1.f ) );
+    hash.query( glm::vec2( 1.f ), glm::vec2( 2.f ), results );
+    REQUIRE( results.size() == 1 );
+    REQUIRE( results[0] == b );
+
+    results.clear();
+    hash.query( glm::vec2( -100.f ), glm::vec2( 100.f ), results );
+    REQUIRE( results.size() == 4 );
+  }
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
@@ -0,0 +1,120 @@
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+// The MIT License (MIT)
+// This source file is part of LORE
+// ( Lightweight Object-oriented Rendering Engine )
+//
+// Copyright (c) 2017-2021 Jordan Sparks
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files ( the "Software" ), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+#include "catch.hpp"
+#include "TestUtils.h"
+
+#include <algorithm>
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+TEST_CASE( "Spatial index", "[scene]" )
+{
+  LoreTestHelper helper;
+
+  auto scene = helper.getContext()->createScene( "spatial", Lore::RendererType::Forward3D );
+
+  // A 10x10 grid of unit boxes on the xz plane, two units apart.
+  Lore::SpatialIndex index;
+  std::vector<Lore::NodePtr> nodes;
+  std::vector<Lore::SpatialIndex::ProxyId> proxies;
+  for ( int i = 0; i < 100; ++i ) {
+    const glm::vec3 center( static_cast< float >( i % 10 ) * 2.f, 0.f, static_cast< float >( i / 10 ) * 2.f );
+    nodes.push_back( scene->createNode( "Node" + std::to_string( i ) ) );
+    proxies.push_back( index.insert( nodes.back(), Lore::BoundingBox( center - glm::vec3( 0.5f ), center + glm::vec3( 0.5f ) ) ) );
+  }
+
+  REQUIRE( index.size() == 100 );
+  // A balanced tree over 100 leaves is far shallower than a list.
+  REQUIRE( index.getHeight() < 16 );
+
+  auto contains = [] ( const Lore::SpatialIndex::NodeList& list, Lore::NodePtr node ) {
+    return std::find( list.begin(), list.end(), node ) != list.end();
+  };
+
+  SECTION( "Box and sphere queries" )
+  {
+    Lore::SpatialIndex::NodeList results;
+    index.queryAABB( Lore::BoundingBox( glm::vec3( -1.f ), glm::vec3( 2.6f, 1.f, 0.6f ) ), results );
+    REQUIRE( results.size() == 2 );
+    REQUIRE( contains( results, nodes[0] ) );
+    REQUIRE( contains( results, nodes[1] ) );
+
+    results.clear();
+    index.querySphere( Lore::BoundingSphere( glm::vec3( 10.f, 0.f, 10.f ), 0.25f ), results );
+    REQUIRE( results.size() == 1 );
+    REQUIRE( results[0] == nodes[55] );
+  }
+
+  SECTION( "Frustum query" )
+  {
+    // Looking down -y from above the first row only.
+    const glm::mat4 projection = glm::ortho( -1.f, 19.f, -1.f, 1.f, 0.f, 20.f );
+    const glm::mat4 view = glm::lookAt( glm::vec3( 0.f, 10.f, 0.f ), glm::vec3( 0.f ), glm::vec3( 0.f, 0.f, -1.f ) );
+
+    Lore::SpatialIndex::NodeList results;
+    index.queryFrustum( Lore::Frustum( projection * view ), results );
+    REQUIRE( results.size() == 10 );
+    for ( int i = 0; i < 10; ++i ) {
+      REQUIRE( contains( results, nodes[i] ) );
+    }
+  }
+
+  SECTION( "Ray query" )
+  {
+    Lore::SpatialIndex::NodeList results;
+    index.queryRay( glm::vec3( -5.f, 0.f, 4.f ), glm::vec3( 1.f, 0.f, 0.f ), results );
+    REQUIRE( results.size() == 10 );
+
+    results.clear();
+    index.queryRay( glm::vec3( -5.f, 0.f, 4.f ), glm::vec3( 1.f, 0.f, 0.f ), results, 6.f );
+    REQUIRE( results.size() == 1 );
+    REQUIRE( results[0] == nodes[20] );
+  }
+
+  SECTION( "Refitting" )
+  {
+    // Small moves stay within the fat bounds and leave the tree alone.
+    const glm::vec3 nudge( Lore::SpatialIndex::DefaultMargin * 0.5f );
+    REQUIRE_FALSE( index.update( proxies[0], Lore::BoundingBox( glm::vec3( -0.5f ) + nudge, glm::vec3( 0.5f ) + nudge ) ) );
+
+    // Large moves reinsert the leaf.
+    REQUIRE( index.update( proxies[0], Lore::BoundingBox( glm::vec3( 99.5f ), glm::vec3( 100.5f ) ) ) );
+
+    Lore::SpatialIndex::NodeList results;
+    index.queryAABB( Lore::BoundingBox( glm::vec3( 99.f ), glm::vec3( 101.f ) ), results );
+    REQUIRE( results.size() == 1 );
+    REQUIRE( results[0] == nodes[0] );
+
+    index.remove( proxies[0] );
+    results.clear();
+    index.queryAABB( Lore::BoundingBox( glm::vec3( 99.f ), glm::vec3( 101.f ) ), results );
+    REQUIRE( results.empty() );
+    REQUIRE( index.size() == 99 );
+  }
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
@@ -0,0 +1,130 @@
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+// The MIT License (MIT)
+// This source file is part of LORE
+// ( Lightweight Object-oriented Rendering Engine )
+//
+// Copyright (c) 2017-2021 Jordan Sparks
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files ( the "Software" ), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+
+#include "catch.hpp"
+#include "TestUtils.h"
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+TEST_CASE( "Scene graph transforms", "[scene]" )
+{
+  LoreTestHelper helper;
+
+  auto scene = helper.getContext()->createScene( "transforms", Lore::RendererType::Forward3D );
+
+  auto parent = scene->createNode( "Parent" );
+  auto child = parent->createChildNode( "Child" );
+  auto grandchild = child->createChildNode( "Grandchild" );
+  auto sibling = scene->createNode( "Sibling" );
+
+  parent->setPosition( 1.f, 0.f, 0.f );
+  parent->setScale( 2.f );
+  child->setPosition( 2.f, 0.f, 0.f );
+  grandchild->setPosition( 4.f, 0.f, 0.f );
+  sibling->setPosition( 8.f, 0.f, 0.f );
+
+  scene->updateSceneGraph();
+
+  // Positions accumulate down the graph, scale is applied to each node's own world matrix.
+  REQUIRE( parent->getWorldPosition().x == Approx( 1.f ) );
+  REQUIRE( child->getWorldPosition().x == Approx( 3.f ) );
+  REQUIRE( grandchild->getWorldPosition().x == Approx( 7.f ) );
+  REQUIRE( sibling->getWorldPosition().x == Approx( 8.f ) );
+  REQUIRE( grandchild->getDerivedScale().x == Approx( 2.f ) );
+  REQUIRE( grandchild->getFullTransform()[0][0] == Approx( 2.f ) );
+
+  // Moving a parent carries its whole subtree, and nothing else.
+  parent->translate( 10.f, 0.f, 0.f );
+  scene->updateSceneGraph();
+  REQUIRE( child->getWorldPosition().x == Approx( 13.f ) );
+  REQUIRE( grandchild->getWorldPosition().x == Approx( 17.f ) );
+  REQUIRE( sibling->getWorldPosition().x == Approx( 8.f ) );
+
+  // Static branches keep their cached world transforms across updates.
+  scene->updateSceneGraph();
+  REQUIRE( grandchild->getWorldPosition().x == Approx( 17.f ) );
+  REQUIRE( sibling->getWorldPosition().x == Approx( 8.f ) );
+
+  // Only the dirty child's subtree moves.
+  child->translate( 0.f, 1.f, 0.f );
+  scene->updateSceneGraph();
+  REQUIRE( parent->getWorldPosition().y == Approx( 0.f ) );
+  REQUIRE( grandchild->getWorldPosition().y == Approx( 1.f ) );
+  child->translate( 0.f, -1.f, 0.f );
+  scene->updateSceneGraph();
+
+  // Destroying nodes leaves the remaining transforms intact once storage is compacted.
+  scene->destroyNode( grandchild );
+  scene->destroyNode( sibling );
+  auto late = child->createChildNode( "Late" );
+  late->setPosition( 0.f, 1.f, 0.f );
+  scene->updateSceneGraph();
+  REQUIRE( child->getWorldPosition().x == Approx( 13.f ) );
+  REQUIRE( late->getWorldPosition().x == Approx( 13.f ) );
+  REQUIRE( late->getWorldPosition().y == Approx( 1.f ) );
+  REQUIRE( child->getPosition().x == Approx( 2.f ) );
+
+  // Forcing an update still accounts for the parent and reaches children.
+  child->updateWorldTransform();
+  scene->updateSceneGraph();
+  REQUIRE( child->getWorldPosition().x == Approx( 13.f ) );
+  REQUIRE( late->getWorldPosition().x == Approx( 13.f ) );
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
+
+TEST_CASE( "Cloned subtree transforms", "[scene]" )
+{
+  LoreTestHelper helper;
+
+  auto scene = helper.getContext()->createScene( "clones", Lore::RendererType::Forward3D );
+
+  auto parent = scene->createNode( "Parent" );
+  auto child = parent->createChildNode( "Child" );
+  parent->setPosition( 1.f, 0.f, 0.f );
+  child->setPosition( 2.f, 0.f, 0.f );
+  scene->updateSceneGraph();
+
+  auto copy = parent->clone( "Copy", true );
+  auto copiedChild = scene->getNode( "Copy_Child" );
+  REQUIRE( copiedChild == copy->getChild( "Copy_Child" ) );
+  REQUIRE_THROWS_AS( parent->getChild( "Copy_Child" ), Lore::ItemIdentityException );
+
+  // The cloned child follows its clone, not the original.
+  copy->translate( 0.f, 5.f, 0.f );
+  scene->updateSceneGraph();
+  REQUIRE( copiedChild->getWorldPosition().x == Approx( 3.f ) );
+  REQUIRE( copiedChild->getWorldPosition().y == Approx( 5.f ) );
+  REQUIRE( child->getWorldPosition().y == Approx( 0.f ) );
+
+  parent->translate( 0.f, -5.f, 0.f );
+  scene->updateSceneGraph();
+  REQUIRE( copiedChild->getWorldPosition().y == Approx( 5.f ) );
+  REQUIRE( child->getWorldPosition().y == Approx( -5.f ) );
+}
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //